@@ -42,6 +42,7 @@ Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
 #include <climits>
 #include <cmath>
 #include <cstring>
+#include <numeric>
 #include "gambit.h"
 
 namespace Gambit {
@@ -92,7 +93,9 @@ long lg(unsigned long x)
 #define MALLOC_MIN_OVERHEAD 4
 #endif
 
-static IntegerRep ZeroRep = {1, 0, 1, {0}};
+// These are shared, and never modified; they must therefore be in normal
+// form from the outset (in particular, zero has length zero)
+static IntegerRep ZeroRep = {0, 0, 1, {0}};
 static IntegerRep OneRep = {1, 0, 1, {1}};
 static IntegerRep MinusOneRep = {1, 0, 0, {1}};
 
@@ -138,7 +141,12 @@ static void Icheck(IntegerRep *rep)
   while (l > 0 && *--p == 0) {
     --l;
   }
-  if ((rep->len = l) == 0) {
+  // Only write if needed: the static representations are shared, and may
+  // be in use on several threads at once
+  if (rep->len != l) {
+    rep->len = l;
+  }
+  if (l == 0 && rep->sgn != I_POSITIVE) {
     rep->sgn = I_POSITIVE;
   }
 }
@@ -324,7 +332,7 @@ IntegerRep *Icopy_ulong(IntegerRep *old, unsigned long x)
   unsigned short srclen = 0;
   while (x != 0) {
     src[srclen++] = extract(x);
-    x = down(x);
+    x >>= I_SHIFT;
   }
 
   IntegerRep *rep;
@@ -378,6 +386,24 @@ IntegerRep *Icopy_one(IntegerRep *old, int newsgn)
   return old;
 }
 
+// Set the sign of a result which may be one of the static representations
+// returned by the Icopy functions.  These are shared, and may be in use on
+// several threads at once, so they are never modified; a fresh
+// representation is allocated if the sign needs to change.
+
+static IntegerRep *Isetsgn(IntegerRep *rep, int newsgn)
+{
+  if (!STATIC_IntegerRep(rep)) {
+    rep->sgn = newsgn;
+    Icheck(rep);
+    return rep;
+  }
+  if (rep->len != 0 && rep->sgn != newsgn) {
+    return Ialloc(nullptr, rep->s, rep->len, newsgn, rep->len);
+  }
+  return rep;
+}
+
 // convert to a legal two's complement long if possible
 // if too big, return most negative/positive value
 
@@ -514,10 +540,12 @@ double ratio(const Integer &num, const Integer &den)
   }
   else // use as much precision as available for fractional part
   {
+    IntegerRepBuffer bd, br;
+    const IntegerRep *drep = den.Rep(bd), *rrep = r.Rep(br);
     double d2 = 0.0;
     double d3 = 0.0;
     int cont = 1;
-    for (int i = den.rep->len - 1; i >= 0 && cont; --i) {
+    for (int i = drep->len - 1; i >= 0 && cont; --i) {
       auto a = (unsigned short)(I_RADIX >> 1);
       while (a != 0) {
         if (d2 + 1.0 == d2) // out of precision when we get here
@@ -527,13 +555,13 @@ double ratio(const Integer &num, const Integer &den)
         }
 
         d2 *= 2.0;
-        if (den.rep->s[i] & a) {
+        if (drep->s[i] & a) {
           d2 += 1.0;
         }
 
-        if (i < r.rep->len) {
+        if (i < rrep->len) {
           d3 *= 2.0;
-          if (r.rep->s[i] & a) {
+          if (rrep->s[i] & a) {
             d3 += 1.0;
           }
         }
@@ -542,7 +570,7 @@ double ratio(const Integer &num, const Integer &den)
       }
     }
 
-    if (sign(r) < 0) {
+    if (sign(r) != sign(den)) {
       d3 = -d3;
     }
     return d1 + d3 / d2;
@@ -1018,8 +1046,7 @@ IntegerRep *multiply(const IntegerRep *x, const IntegerRep *y, IntegerRep *r)
       }
     }
   }
-  r->sgn = rsgn;
-  Icheck(r);
+  r = Isetsgn(r, rsgn);
   return r;
 }
 
@@ -1271,8 +1298,7 @@ IntegerRep *div(const IntegerRep *x, const IntegerRep *y, IntegerRep *q)
       delete r;
     }
   }
-  q->sgn = samesign;
-  Icheck(q);
+  q = Isetsgn(q, samesign);
   return q;
 }
 
@@ -1341,100 +1367,39 @@ IntegerRep *div(const IntegerRep *x, long y, IntegerRep *q)
       delete r;
     }
   }
-  q->sgn = samesign;
-  Icheck(q);
+  q = Isetsgn(q, samesign);
   return q;
 }
 
 void divide(const Integer &Ix, long y, Integer &Iq, long &rem)
 {
-  const IntegerRep *x = Ix.rep;
-  nonnil(x);
-  IntegerRep *q = Iq.rep;
-  int xl = x->len;
   if (y == 0) {
     throw Gambit::ZeroDivideException();
   }
-  unsigned short ys[SHORT_PER_LONG];
-  unsigned long u;
-  int ysgn = y >= 0;
-  if (ysgn) {
-    u = y;
-  }
-  else {
-    u = -y;
-  }
-  int yl = 0;
-  while (u != 0) {
-    ys[yl++] = extract(u);
-    u = down(u);
-  }
-
-  int comp = xl - yl;
-  if (comp == 0) {
-    comp = docmp(x->s, ys, xl);
-  }
-
-  int xsgn = x->sgn;
-  int samesign = xsgn == ysgn;
-
-  if (comp < 0) {
-    rem = Itolong(x);
-    q = Icopy_zero(q);
-  }
-  else if (comp == 0) {
-    q = Icopy_one(q, samesign);
-    rem = 0;
-  }
-  else if (yl == 1) {
-    q = Icopy(q, x);
-    rem = unscale(q->s, q->len, ys[0], q->s);
-  }
-  else {
-    IntegerRep *r = nullptr;
-    auto prescale = (unsigned short)(I_RADIX / (1 + ys[yl - 1]));
-    if (prescale != 1) {
-      unsigned long prod = (unsigned long)prescale * (unsigned long)ys[0];
-      ys[0] = extract(prod);
-      prod = down(prod) + (unsigned long)prescale * (unsigned long)ys[1];
-      ys[1] = extract(prod);
-      r = multiply(x, ((long)prescale & I_MAXNUM), r);
-    }
-    else {
-      r = Icalloc(r, xl + 1);
-      scpy(x->s, r->s, xl);
-    }
-
-    int ql = xl - yl + 1;
-
-    q = Icalloc(q, ql);
-
-    do_divide(r->s, ys, yl, q->s, ql);
-
-    if (prescale != 1) {
-      Icheck(r);
-      unscale(r->s, r->len, prescale, r->s);
-    }
-    Icheck(r);
-    rem = Itolong(r);
-    if (!STATIC_IntegerRep(r)) {
-      delete r;
-    }
-  }
-  rem = abs(Integer(rem)).as_long();
-  if (xsgn == I_NEGATIVE) {
-    rem = -rem;
+  if (Ix.rep == nullptr && (Ix.m_small != INT64_MIN || y != -1)) {
+    int64_t x = Ix.m_small;
+    Iq.SetSmall(x / y);
+    rem = (long)(x % y);
+    return;
   }
-  q->sgn = samesign;
-  Icheck(q);
-  Iq.rep = q;
+  Integer r;
+  divide(Ix, Integer(y), Iq, r);
+  rem = r.as_long();
 }
 
 void divide(const Integer &Ix, const Integer &Iy, Integer &Iq, Integer &Ir)
 {
-  const IntegerRep *x = Ix.rep;
+  if (Ix.rep == nullptr && Iy.rep == nullptr && Iy.m_small != 0 &&
+      (Ix.m_small != INT64_MIN || Iy.m_small != -1)) {
+    int64_t xs = Ix.m_small, ys = Iy.m_small;
+    Iq.SetSmall(xs / ys);
+    Ir.SetSmall(xs % ys);
+    return;
+  }
+  IntegerRepBuffer bx, by;
+  const IntegerRep *x = Ix.Rep(bx);
   nonnil(x);
-  const IntegerRep *y = Iy.rep;
+  const IntegerRep *y = Iy.Rep(by);
   nonnil(y);
   IntegerRep *q = Iq.rep;
   IntegerRep *r = Ir.rep;
@@ -1476,6 +1441,7 @@ void divide(const Integer &Ix, const Integer &Iy, Integer &Iq, Integer &Ir)
     else {
       yy = const_cast<IntegerRep *>(y);
       r = Icalloc(r, xl + 1);
+      r->sgn = xsgn;
       scpy(x->s, r->s, xl);
     }
 
@@ -1492,11 +1458,12 @@ void divide(const Integer &Ix, const Integer &Iy, Integer &Iq, Integer &Ir)
       unscale(r->s, r->len, prescale, r->s);
     }
   }
-  q->sgn = samesign;
-  Icheck(q);
+  q = Isetsgn(q, samesign);
   Iq.rep = q;
+  Iq.Normalize();
   Icheck(r);
   Ir.rep = r;
+  Ir.Normalize();
 }
 
 IntegerRep *mod(const IntegerRep *x, const IntegerRep *y, IntegerRep *r)
@@ -1536,6 +1503,7 @@ IntegerRep *mod(const IntegerRep *x, const IntegerRep *y, IntegerRep *r)
     else {
       yy = const_cast<IntegerRep *>(y);
       r = Icalloc(r, xl + 1);
+      r->sgn = xsgn;
       scpy(x->s, r->s, xl);
     }
 
@@ -1693,8 +1661,7 @@ IntegerRep *lshift(const IntegerRep *x, long y, IntegerRep *r)
       }
     }
   }
-  r->sgn = rsgn;
-  Icheck(r);
+  r = Isetsgn(r, rsgn);
   return r;
 }
 
@@ -1875,12 +1842,17 @@ void(setbit)(Integer &x, long b)
   if (b >= 0) {
     int bw = (int)((unsigned long)b / I_SHIFT);
     int sw = (int)((unsigned long)b % I_SHIFT);
-    int xl = x.rep ? x.rep->len : 0;
+    if (x.rep == nullptr) {
+      IntegerRepBuffer bx;
+      x.rep = Icopy(nullptr, x.Rep(bx));
+    }
+    int xl = x.rep->len;
     if (xl <= bw) {
       x.rep = Iresize(x.rep, calc_len(xl, bw + 1, 0));
     }
     x.rep->s[bw] |= (1 << sw);
     Icheck(x.rep);
+    x.Normalize();
   }
 }
 
@@ -1888,25 +1860,27 @@ void clearbit(Integer &x, long b)
 {
   if (b >= 0) {
     if (x.rep == nullptr) {
-      x.rep = &ZeroRep;
+      IntegerRepBuffer bx;
+      x.rep = Icopy(nullptr, x.Rep(bx));
     }
-    else {
-      int bw = (int)((unsigned long)b / I_SHIFT);
-      int sw = (int)((unsigned long)b % I_SHIFT);
-      if (x.rep->len > bw) {
-        x.rep->s[bw] &= ~(1 << sw);
-      }
+    int bw = (int)((unsigned long)b / I_SHIFT);
+    int sw = (int)((unsigned long)b % I_SHIFT);
+    if (x.rep->len > bw) {
+      x.rep->s[bw] &= ~(1 << sw);
     }
     Icheck(x.rep);
+    x.Normalize();
   }
 }
 
 int testbit(const Integer &x, long b)
 {
-  if (x.rep != nullptr && b >= 0) {
+  if (b >= 0) {
+    IntegerRepBuffer bx;
+    const IntegerRep *xrep = x.Rep(bx);
     int bw = (int)((unsigned long)b / I_SHIFT);
     int sw = (int)((unsigned long)b % I_SHIFT);
-    return (bw < x.rep->len && (x.rep->s[bw] & (1 << sw)) != 0);
+    return (bw < xrep->len && (xrep->s[bw] & (1 << sw)) != 0);
   }
   else {
     return 0;
@@ -2071,8 +2045,7 @@ IntegerRep *power(const IntegerRep *x, long y, IntegerRep *r)
       delete b;
     }
   }
-  r->sgn = sgn;
-  Icheck(r);
+  r = Isetsgn(r, sgn);
   return r;
 }
 
@@ -2235,7 +2208,11 @@ std::string Itoa(const IntegerRep *x, int base, int width)
   return cvtItoa(x, fmtbase, fmtlen, base, 0, width, 0, ' ', 'X', 0);
 }
 
-std::ostream &operator<<(std::ostream &s, const Integer &y) { return s << Itoa(y.rep); }
+std::ostream &operator<<(std::ostream &s, const Integer &y)
+{
+  IntegerRepBuffer by;
+  return s << Itoa(y.Rep(by));
+}
 
 std::string cvtItoa(const IntegerRep *x, std::string fmt, int &fmtlen, int base, int showbase,
                     int width, int align_right, char fillchar, char Xcase, int showpos)
@@ -2340,7 +2317,7 @@ std::istream &operator>>(std::istream &s, Integer &y)
 {
   char sgn = 0;
   char ch;
-  y.rep = Icopy_zero(y.rep);
+  y.SetSmall(0);
 
   do {
     s.get(ch);
@@ -2379,7 +2356,10 @@ std::istream &operator>>(std::istream &s, Integer &y)
 
 int Integer::OK() const
 {
-  if (rep != nullptr) {
+  if (rep == nullptr) {
+    return 1;
+  }
+  else {
     int l = rep->len;
     int s = rep->sgn;
     int v = l <= rep->sz || STATIC_IntegerRep(rep); // length within bounds
@@ -2404,17 +2384,28 @@ void Integer::error(const char *msg) const
 // The following were moved from the header file to stop BC from squealing
 // endless quantities of warnings
 
-Integer::Integer() : rep(&ZeroRep) {}
+Integer::Integer() : rep(nullptr), m_small(0) {}
 
-Integer::Integer(IntegerRep *r) : rep(r) {}
+Integer::Integer(IntegerRep *r) : rep(r), m_small(0) { Normalize(); }
 
-Integer::Integer(int y) : rep(Icopy_long(nullptr, (long)y)) {}
+Integer::Integer(int y) : rep(nullptr), m_small(y) {}
 
-Integer::Integer(long y) : rep(Icopy_long(nullptr, y)) {}
+Integer::Integer(long y) : rep(nullptr), m_small(y) {}
 
-Integer::Integer(unsigned long y) : rep(Icopy_ulong(nullptr, y)) {}
+Integer::Integer(unsigned long y) : rep(nullptr), m_small(0)
+{
+  if (y <= (unsigned long)INT64_MAX) {
+    m_small = (int64_t)y;
+  }
+  else {
+    rep = Icopy_ulong(nullptr, y);
+  }
+}
 
-Integer::Integer(const Integer &y) : rep(Icopy(nullptr, y.rep)) {}
+Integer::Integer(const Integer &y)
+  : rep((y.rep) ? Icopy(nullptr, y.rep) : nullptr), m_small(y.m_small)
+{
+}
 
 Integer::~Integer()
 {
@@ -2425,99 +2416,253 @@ Integer::~Integer()
 
 Integer &Integer::operator=(const Integer &y)
 {
-  rep = Icopy(rep, y.rep);
+  if (y.rep) {
+    rep = Icopy(rep, y.rep);
+  }
+  else {
+    SetSmall(y.m_small);
+  }
   return *this;
 }
 
 Integer &Integer::operator=(long y)
 {
-  rep = Icopy_long(rep, y);
+  SetSmall(y);
   return *this;
 }
 
-int Integer::initialized() const { return rep != nullptr; }
+int Integer::initialized() const { return 1; }
+
+const IntegerRep *Integer::Rep(IntegerRepBuffer &buf) const
+{
+  if (rep) {
+    return rep;
+  }
+  auto *r = reinterpret_cast<IntegerRep *>(buf.data);
+  uint64_t u = (m_small < 0) ? -(uint64_t)m_small : (uint64_t)m_small;
+  int l = 0;
+  for (; u != 0; u >>= I_SHIFT) {
+    r->s[l++] = (unsigned short)(u & I_MAXNUM);
+  }
+  r->len = l;
+  r->sz = 0;
+  r->sgn = (m_small >= 0) ? I_POSITIVE : I_NEGATIVE;
+  return r;
+}
+
+void Integer::SetSmall(int64_t y)
+{
+  if (rep) {
+    if (!STATIC_IntegerRep(rep)) {
+      delete[] rep;
+    }
+    rep = nullptr;
+  }
+  m_small = y;
+}
+
+void Integer::Normalize()
+{
+  if (rep == nullptr || rep->len > 64 / I_SHIFT) {
+    return;
+  }
+  uint64_t u = 0;
+  for (int i = rep->len - 1; i >= 0; --i) {
+    u = (u << I_SHIFT) | rep->s[i];
+  }
+  if (rep->sgn == I_POSITIVE) {
+    if (u > (uint64_t)INT64_MAX) {
+      return;
+    }
+    SetSmall((int64_t)u);
+  }
+  else {
+    if (u > (uint64_t)INT64_MAX + 1) {
+      return;
+    }
+    SetSmall(-(int64_t)(u - 1) - 1);
+  }
+}
 
 // procedural versions
+//
+// Each operation is done on the values held in 64 bits when it cannot
+// overflow, and otherwise on the representations.
 
-int compare(const Integer &x, const Integer &y) { return compare(x.rep, y.rep); }
+int compare(const Integer &x, const Integer &y)
+{
+  if (x.rep == nullptr && y.rep == nullptr) {
+    return (x.m_small < y.m_small) ? -1 : (x.m_small > y.m_small);
+  }
+  IntegerRepBuffer bx, by;
+  return compare(x.Rep(bx), y.Rep(by));
+}
 
-int ucompare(const Integer &x, const Integer &y) { return ucompare(x.rep, y.rep); }
+int ucompare(const Integer &x, const Integer &y)
+{
+  if (x.rep == nullptr && y.rep == nullptr) {
+    uint64_t ux = (x.m_small < 0) ? -(uint64_t)x.m_small : (uint64_t)x.m_small;
+    uint64_t uy = (y.m_small < 0) ? -(uint64_t)y.m_small : (uint64_t)y.m_small;
+    return (ux < uy) ? -1 : (ux > uy);
+  }
+  IntegerRepBuffer bx, by;
+  return ucompare(x.Rep(bx), y.Rep(by));
+}
 
-int compare(const Integer &x, long y) { return compare(x.rep, y); }
+int compare(const Integer &x, long y) { return compare(x, Integer(y)); }
 
-int ucompare(const Integer &x, long y) { return ucompare(x.rep, y); }
+int ucompare(const Integer &x, long y) { return ucompare(x, Integer(y)); }
 
-int compare(long x, const Integer &y) { return -compare(y.rep, x); }
+int compare(long x, const Integer &y) { return compare(Integer(x), y); }
 
-int ucompare(long x, const Integer &y) { return -ucompare(y.rep, x); }
+int ucompare(long x, const Integer &y) { return ucompare(Integer(x), y); }
 
 void add(const Integer &x, const Integer &y, Integer &dest)
 {
-  dest.rep = add(x.rep, 0, y.rep, 0, dest.rep);
+  int64_t z;
+  if (x.rep == nullptr && y.rep == nullptr && !__builtin_add_overflow(x.m_small, y.m_small, &z)) {
+    dest.SetSmall(z);
+    return;
+  }
+  IntegerRepBuffer bx, by;
+  dest.rep = add(x.Rep(bx), 0, y.Rep(by), 0, dest.rep);
+  dest.Normalize();
 }
 
 void sub(const Integer &x, const Integer &y, Integer &dest)
 {
-  dest.rep = add(x.rep, 0, y.rep, 1, dest.rep);
+  int64_t z;
+  if (x.rep == nullptr && y.rep == nullptr && !__builtin_sub_overflow(x.m_small, y.m_small, &z)) {
+    dest.SetSmall(z);
+    return;
+  }
+  IntegerRepBuffer bx, by;
+  dest.rep = add(x.Rep(bx), 0, y.Rep(by), 1, dest.rep);
+  dest.Normalize();
 }
 
 void mul(const Integer &x, const Integer &y, Integer &dest)
 {
-  dest.rep = multiply(x.rep, y.rep, dest.rep);
+  int64_t z;
+  if (x.rep == nullptr && y.rep == nullptr && !__builtin_mul_overflow(x.m_small, y.m_small, &z)) {
+    dest.SetSmall(z);
+    return;
+  }
+  IntegerRepBuffer bx, by;
+  dest.rep = multiply(x.Rep(bx), y.Rep(by), dest.rep);
+  dest.Normalize();
 }
 
 void div(const Integer &x, const Integer &y, Integer &dest)
 {
-  dest.rep = div(x.rep, y.rep, dest.rep);
+  if (x.rep == nullptr && y.rep == nullptr && y.m_small != 0 &&
+      (x.m_small != INT64_MIN || y.m_small != -1)) {
+    dest.SetSmall(x.m_small / y.m_small);
+    return;
+  }
+  IntegerRepBuffer bx, by;
+  dest.rep = div(x.Rep(bx), y.Rep(by), dest.rep);
+  dest.Normalize();
 }
 
 void mod(const Integer &x, const Integer &y, Integer &dest)
 {
-  dest.rep = mod(x.rep, y.rep, dest.rep);
+  if (x.rep == nullptr && y.rep == nullptr && y.m_small != 0 &&
+      (x.m_small != INT64_MIN || y.m_small != -1)) {
+    dest.SetSmall(x.m_small % y.m_small);
+    return;
+  }
+  IntegerRepBuffer bx, by;
+  dest.rep = mod(x.Rep(bx), y.Rep(by), dest.rep);
+  dest.Normalize();
 }
 
 void lshift(const Integer &x, const Integer &y, Integer &dest)
 {
-  dest.rep = lshift(x.rep, y.rep, 0, dest.rep);
+  IntegerRepBuffer bx, by;
+  dest.rep = lshift(x.Rep(bx), y.Rep(by), 0, dest.rep);
+  dest.Normalize();
 }
 
 void rshift(const Integer &x, const Integer &y, Integer &dest)
 {
-  dest.rep = lshift(x.rep, y.rep, 1, dest.rep);
+  IntegerRepBuffer bx, by;
+  dest.rep = lshift(x.Rep(bx), y.Rep(by), 1, dest.rep);
+  dest.Normalize();
 }
 
 void pow(const Integer &x, const Integer &y, Integer &dest)
 {
-  dest.rep = power(x.rep, Itolong(y.rep), dest.rep); // not incorrect
+  IntegerRepBuffer bx;
+  dest.rep = power(x.Rep(bx), y.as_long(), dest.rep); // not incorrect
+  dest.Normalize();
 }
 
-void add(const Integer &x, long y, Integer &dest) { dest.rep = add(x.rep, 0, y, dest.rep); }
+void add(const Integer &x, long y, Integer &dest) { add(x, Integer(y), dest); }
 
-void sub(const Integer &x, long y, Integer &dest) { dest.rep = add(x.rep, 0, -y, dest.rep); }
+void sub(const Integer &x, long y, Integer &dest) { sub(x, Integer(y), dest); }
 
-void mul(const Integer &x, long y, Integer &dest) { dest.rep = multiply(x.rep, y, dest.rep); }
+void mul(const Integer &x, long y, Integer &dest) { mul(x, Integer(y), dest); }
 
-void div(const Integer &x, long y, Integer &dest) { dest.rep = div(x.rep, y, dest.rep); }
+void div(const Integer &x, long y, Integer &dest) { div(x, Integer(y), dest); }
 
-void mod(const Integer &x, long y, Integer &dest) { dest.rep = mod(x.rep, y, dest.rep); }
+void mod(const Integer &x, long y, Integer &dest) { mod(x, Integer(y), dest); }
 
-void lshift(const Integer &x, long y, Integer &dest) { dest.rep = lshift(x.rep, y, dest.rep); }
+void lshift(const Integer &x, long y, Integer &dest)
+{
+  IntegerRepBuffer bx;
+  dest.rep = lshift(x.Rep(bx), y, dest.rep);
+  dest.Normalize();
+}
 
-void rshift(const Integer &x, long y, Integer &dest) { dest.rep = lshift(x.rep, -y, dest.rep); }
+void rshift(const Integer &x, long y, Integer &dest)
+{
+  IntegerRepBuffer bx;
+  dest.rep = lshift(x.Rep(bx), -y, dest.rep);
+  dest.Normalize();
+}
 
-void pow(const Integer &x, long y, Integer &dest) { dest.rep = power(x.rep, y, dest.rep); }
+void pow(const Integer &x, long y, Integer &dest)
+{
+  IntegerRepBuffer bx;
+  dest.rep = power(x.Rep(bx), y, dest.rep);
+  dest.Normalize();
+}
 
-void abs(const Integer &x, Integer &dest) { dest.rep = abs(x.rep, dest.rep); }
+void abs(const Integer &x, Integer &dest)
+{
+  if (x.rep == nullptr && x.m_small != INT64_MIN) {
+    dest.SetSmall((x.m_small < 0) ? -x.m_small : x.m_small);
+    return;
+  }
+  IntegerRepBuffer bx;
+  dest.rep = abs(x.Rep(bx), dest.rep);
+  dest.Normalize();
+}
 
-void negate(const Integer &x, Integer &dest) { dest.rep = negate(x.rep, dest.rep); }
+void negate(const Integer &x, Integer &dest)
+{
+  if (x.rep == nullptr && x.m_small != INT64_MIN) {
+    dest.SetSmall(-x.m_small);
+    return;
+  }
+  IntegerRepBuffer bx;
+  dest.rep = negate(x.Rep(bx), dest.rep);
+  dest.Normalize();
+}
 
-void complement(const Integer &x, Integer &dest) { dest.rep = Compl(x.rep, dest.rep); }
+void complement(const Integer &x, Integer &dest)
+{
+  IntegerRepBuffer bx;
+  dest.rep = Compl(x.Rep(bx), dest.rep);
+  dest.Normalize();
+}
 
-void add(long x, const Integer &y, Integer &dest) { dest.rep = add(y.rep, 0, x, dest.rep); }
+void add(long x, const Integer &y, Integer &dest) { add(Integer(x), y, dest); }
 
-void sub(long x, const Integer &y, Integer &dest) { dest.rep = add(y.rep, 1, x, dest.rep); }
+void sub(long x, const Integer &y, Integer &dest) { sub(Integer(x), y, dest); }
 
-void mul(long x, const Integer &y, Integer &dest) { dest.rep = multiply(y.rep, x, dest.rep); }
+void mul(long x, const Integer &y, Integer &dest) { mul(Integer(x), y, dest); }
 
 // operator versions
 
@@ -2625,15 +2770,41 @@ void Integer::abs() { Gambit::abs(*this, *this); }
 
 void Integer::negate() { Gambit::negate(*this, *this); }
 
-int sign(const Integer &x) { return (x.rep->len == 0) ? 0 : ((x.rep->sgn == 1) ? 1 : -1); }
+int sign(const Integer &x)
+{
+  if (x.rep == nullptr) {
+    return (x.m_small > 0) - (x.m_small < 0);
+  }
+  return (x.rep->len == 0) ? 0 : ((x.rep->sgn == 1) ? 1 : -1);
+}
 
-int even(const Integer &y) { return y.rep->len == 0 || !(y.rep->s[0] & 1); }
+int even(const Integer &y)
+{
+  if (y.rep == nullptr) {
+    return !(y.m_small & 1);
+  }
+  return y.rep->len == 0 || !(y.rep->s[0] & 1);
+}
 
-int odd(const Integer &y) { return y.rep->len > 0 && (y.rep->s[0] & 1); }
+int odd(const Integer &y)
+{
+  if (y.rep == nullptr) {
+    return (y.m_small & 1) != 0;
+  }
+  return y.rep->len > 0 && (y.rep->s[0] & 1);
+}
 
-std::string Itoa(const Integer &y, int base, int width) { return Itoa(y.rep, base, width); }
+std::string Itoa(const Integer &y, int base, int width)
+{
+  IntegerRepBuffer by;
+  return Itoa(y.Rep(by), base, width);
+}
 
-long lg(const Integer &x) { return lg(x.rep); }
+long lg(const Integer &x)
+{
+  IntegerRepBuffer bx;
+  return lg(x.Rep(bx));
+}
 
 // constructive operations
 
@@ -2779,16 +2950,23 @@ Integer Integer::operator-() const
 
 Integer atoI(const char *s, int base)
 {
-  Integer r;
-  r.rep = atoIntegerRep(s, base);
-  return r;
+  return Integer(atoIntegerRep(s, base));
 }
 
 Integer gcd(const Integer &x, const Integer &y)
 {
-  Integer r;
-  r.rep = gcd(x.rep, y.rep);
-  return r;
+  if (x.rep == nullptr && y.rep == nullptr) {
+    uint64_t u = (x.m_small < 0) ? -(uint64_t)x.m_small : (uint64_t)x.m_small;
+    uint64_t v = (y.m_small < 0) ? -(uint64_t)y.m_small : (uint64_t)y.m_small;
+    uint64_t g = std::gcd(u, v);
+    if (g <= (uint64_t)INT64_MAX) {
+      Integer r;
+      r.m_small = (int64_t)g;
+      return r;
+    }
+  }
+  IntegerRepBuffer bx, by;
+  return Integer(gcd(x.Rep(bx), y.Rep(by)));
 }
 
 Integer &Integer::operator%=(const Integer &y)
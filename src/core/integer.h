@@ -28,6 +28,8 @@ Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
 #ifndef LIBGAMBIT_INTEGER_H
 #define LIBGAMBIT_INTEGER_H
 
+#include <climits>
+#include <cstdint>
 #include <string>
 
 namespace Gambit {
@@ -44,6 +46,11 @@ struct IntegerRep // internal Integer representations
 // and should not be deleted by an Integer destructor.
 #define STATIC_IntegerRep(rep) ((rep)->sz == 0)
 
+// Storage for a static IntegerRep large enough to hold any 64-bit value
+struct IntegerRepBuffer {
+  alignas(IntegerRep) unsigned char data[sizeof(IntegerRep) + 3 * sizeof(unsigned short)];
+};
+
 extern IntegerRep *Ialloc(IntegerRep *, const unsigned short *, int, int, int);
 extern IntegerRep *Icalloc(IntegerRep *, int);
 extern IntegerRep *Icopy_ulong(IntegerRep *, unsigned long);
@@ -84,7 +91,17 @@ extern long lg(const IntegerRep *);
 
 class Integer {
 protected:
+  // Values which fit in 64 bits are held in m_small, and rep is null;
+  // only larger values are held in an allocated representation.
   IntegerRep *rep;
+  int64_t m_small;
+
+  /// Returns the representation, building it in the buffer if the value is small
+  const IntegerRep *Rep(IntegerRepBuffer &) const;
+  /// Sets the value to one held in m_small, releasing any representation
+  void SetSmall(int64_t);
+  /// Moves the value into m_small, releasing the representation, if it fits
+  void Normalize();
 
 public:
   /// @name Lifecycle
@@ -216,11 +233,20 @@ public:
 
   // coercion & conversion
 
-  int fits_in_long() const { return Iislong(rep); }
-  int fits_in_double() const { return Iisdouble(rep); }
-
-  long as_long() const { return Itolong(rep); }
-  double as_double() const { return Itodouble(rep); }
+  int fits_in_long() const
+  {
+    return (rep) ? Iislong(rep) : (m_small >= LONG_MIN && m_small <= LONG_MAX);
+  }
+  int fits_in_double() const { return (rep) ? Iisdouble(rep) : 1; }
+
+  long as_long() const
+  {
+    if (rep) {
+      return Itolong(rep);
+    }
+    return (m_small > LONG_MAX) ? LONG_MAX : (m_small < LONG_MIN) ? LONG_MIN : (long)m_small;
+  }
+  double as_double() const { return (rep) ? Itodouble(rep) : (double)m_small; }
 
   friend std::string Itoa(const Integer &x, int base /*= 10*/, int width /*= 0*/);
   friend Integer atoI(const char *s, int base /*= 10*/);
@@ -379,15 +379,12 @@ int Rational::fits_in_double() const
 // These were moved from the header file to eliminate warnings
 //
 
-static IntegerRep ZeroRep = {1, 0, 1, {0}};
-static IntegerRep OneRep = {1, 0, 1, {1}};
-
-Rational::Rational() : num(&ZeroRep), den(&OneRep) {}
+Rational::Rational() : num(0), den(1) {}
 Rational::~Rational() = default;
 
 Rational::Rational(const Rational &y) = default;
 
-Rational::Rational(const Integer &n) : num(n), den(&OneRep) {}
+Rational::Rational(const Integer &n) : num(n), den(1) {}
 
 Rational::Rational(const Integer &n, const Integer &d) : num(n), den(d)
 {
@@ -397,9 +394,9 @@ Rational::Rational(const Integer &n, const Integer &d) : num(n), den(d)
   normalize();
 }
 
-Rational::Rational(long n) : num(n), den(&OneRep) {}
+Rational::Rational(long n) : num(n), den(1) {}
 
-Rational::Rational(int n) : num(n), den(&OneRep) {}
+Rational::Rational(int n) : num(n), den(1) {}
 
 Rational::Rational(long n, long d) : num(n), den(d)
 {
@@ -29,6 +29,17 @@
 
 namespace Gambit {
 
+namespace {
+
+/// Cached values are not stored for the chance player; these are reported as zero.
+template <class T> const T &ChanceValue()
+{
+  static const T zero(0);
+  return zero;
+}
+
+} // end anonymous namespace
+
 //========================================================================
 //                  MixedBehaviorProfile<T>: Lifecycle
 //========================================================================
@@ -36,7 +47,9 @@ namespace Gambit {
 template <class T>
 MixedBehaviorProfile<T>::MixedBehaviorProfile(const Game &p_game)
   : m_probs(p_game->NumActions()), m_support(BehaviorSupportProfile(p_game)),
-    m_gameversion(p_game->GetVersion())
+    m_gameversion(p_game->GetVersion()), m_infosetValues(p_game->NumInfosets()),
+    m_actionProbs(p_game->NumActions()), m_actionValues(p_game->NumActions()),
+    m_regret(p_game->NumActions())
 {
   SetCentroid();
 }
@@ -44,7 +57,11 @@ MixedBehaviorProfile<T>::MixedBehaviorProfile(const Game &p_game)
 template <class T>
 MixedBehaviorProfile<T>::MixedBehaviorProfile(const BehaviorSupportProfile &p_support)
   : m_probs(p_support.NumActions()), m_support(p_support),
-    m_gameversion(p_support.GetGame()->GetVersion())
+    m_gameversion(p_support.GetGame()->GetVersion()),
+    m_infosetValues(p_support.GetGame()->NumInfosets()),
+    m_actionProbs(p_support.GetGame()->NumActions()),
+    m_actionValues(p_support.GetGame()->NumActions()),
+    m_regret(p_support.GetGame()->NumActions())
 {
   SetCentroid();
 }
@@ -107,7 +124,11 @@ void MixedBehaviorProfile<T>::RealizationProbs(const MixedStrategyProfile<T> &mp
 template <class T>
 MixedBehaviorProfile<T>::MixedBehaviorProfile(const MixedStrategyProfile<T> &p_profile)
   : m_probs(p_profile.GetGame()->NumActions()), m_support(p_profile.GetGame()),
-    m_gameversion(p_profile.GetGame()->GetVersion())
+    m_gameversion(p_profile.GetGame()->GetVersion()),
+    m_infosetValues(p_profile.GetGame()->NumInfosets()),
+    m_actionProbs(p_profile.GetGame()->NumActions()),
+    m_actionValues(p_profile.GetGame()->NumActions()),
+    m_regret(p_profile.GetGame()->NumActions())
 {
   static_cast<Vector<T> &>(m_probs) = T(0);
 
@@ -145,12 +166,15 @@ MixedBehaviorProfile<T>::operator=(const MixedBehaviorProfile<T> &p_profile)
   InvalidateCache();
   m_probs = p_profile.m_probs;
   m_gameversion = p_profile.m_gameversion;
-  map_realizProbs = p_profile.map_realizProbs;
-  map_beliefs = p_profile.map_beliefs;
-  map_nodeValues = p_profile.map_nodeValues;
-  map_infosetValues = p_profile.map_infosetValues;
-  map_actionValues = p_profile.map_actionValues;
-  map_regret = p_profile.map_regret;
+  m_realizProbs = p_profile.m_realizProbs;
+  m_beliefs = p_profile.m_beliefs;
+  m_nodeValues = p_profile.m_nodeValues;
+  m_infosetProbs = p_profile.m_infosetProbs;
+  m_infosetValues = p_profile.m_infosetValues;
+  m_actionProbs = p_profile.m_actionProbs;
+  m_actionValues = p_profile.m_actionValues;
+  m_regret = p_profile.m_regret;
+  m_cacheValid = p_profile.m_cacheValid;
   return *this;
 }
 
@@ -247,7 +271,7 @@ template <class T> const T &MixedBehaviorProfile<T>::GetRealizProb(const GameNod
 {
   CheckVersion();
   ComputeSolutionData();
-  return map_realizProbs[node];
+  return m_realizProbs[node->GetNumber() - 1];
 }
 
 template <class T> T MixedBehaviorProfile<T>::GetInfosetProb(const GameInfoset &iset) const
@@ -255,8 +279,8 @@ template <class T> T MixedBehaviorProfile<T>::GetInfosetProb(const GameInfoset &
   CheckVersion();
   ComputeSolutionData();
   T prob = T(0);
-  for (auto iset : iset->GetMembers()) {
-    prob += map_realizProbs[iset];
+  for (auto member : dynamic_cast<GameTreeInfosetRep &>(*iset).m_members) {
+    prob += m_realizProbs[member->number - 1];
   }
   return prob;
 }
@@ -265,17 +289,17 @@ template <class T> const T &MixedBehaviorProfile<T>::GetBeliefProb(const GameNod
 {
   CheckVersion();
   ComputeSolutionData();
-  return map_beliefs[node];
+  return m_beliefs[node->GetNumber() - 1];
 }
 
 template <class T> Vector<T> MixedBehaviorProfile<T>::GetPayoff(const GameNode &node) const
 {
   CheckVersion();
   ComputeSolutionData();
-  Vector<T> ret(node->GetGame()->NumPlayers());
-  auto players = node->GetGame()->GetPlayers();
-  std::transform(players.begin(), players.end(), ret.begin(),
-                 [this, node](GamePlayer player) { return map_nodeValues[node][player]; });
+  const int numPlayers = node->GetGame()->NumPlayers();
+  Vector<T> ret(numPlayers);
+  std::copy_n(m_nodeValues.begin() + (node->GetNumber() - 1) * numPlayers, numPlayers,
+              ret.begin());
   return ret;
 }
 
@@ -285,14 +309,21 @@ const T &MixedBehaviorProfile<T>::GetPayoff(const GamePlayer &p_player,
 {
   CheckVersion();
   ComputeSolutionData();
-  return map_nodeValues[p_node][p_player];
+  if (p_player->IsChance()) {
+    return ChanceValue<T>();
+  }
+  return m_nodeValues[(p_node->GetNumber() - 1) * p_node->GetGame()->NumPlayers() +
+                      p_player->GetNumber() - 1];
 }
 
 template <class T> const T &MixedBehaviorProfile<T>::GetPayoff(const GameInfoset &iset) const
 {
   CheckVersion();
   ComputeSolutionData();
-  return map_infosetValues[iset];
+  if (iset->IsChanceInfoset()) {
+    return ChanceValue<T>();
+  }
+  return m_infosetValues(iset->GetPlayer()->GetNumber(), iset->GetNumber());
 }
 
 template <class T> T MixedBehaviorProfile<T>::GetActionProb(const GameAction &action) const
@@ -316,14 +347,22 @@ template <class T> const T &MixedBehaviorProfile<T>::GetPayoff(const GameAction
 {
   CheckVersion();
   ComputeSolutionData();
-  return map_actionValues[act];
+  if (act->GetInfoset()->IsChanceInfoset()) {
+    return ChanceValue<T>();
+  }
+  return m_actionValues(act->GetInfoset()->GetPlayer()->GetNumber(),
+                        act->GetInfoset()->GetNumber(), act->GetNumber());
 }
 
 template <class T> const T &MixedBehaviorProfile<T>::GetRegret(const GameAction &act) const
 {
   CheckVersion();
   ComputeSolutionData();
-  return map_regret[act];
+  if (act->GetInfoset()->IsChanceInfoset()) {
+    return ChanceValue<T>();
+  }
+  return m_regret(act->GetInfoset()->GetPlayer()->GetNumber(), act->GetInfoset()->GetNumber(),
+                  act->GetNumber());
 }
 
 template <class T> T MixedBehaviorProfile<T>::GetRegret(const GameInfoset &p_infoset) const
@@ -400,9 +439,8 @@ T MixedBehaviorProfile<T>::DiffActionValue(const GameAction &p_action,
     GameNode child = member->GetChild(p_action);
 
     deriv += DiffRealizProb(member, p_oppAction) *
-             (map_nodeValues[child][player] - map_actionValues[p_action]);
-    deriv += map_realizProbs[member] *
-             DiffNodeValue(member->GetChild(p_action->GetNumber()), player, p_oppAction);
+             (GetPayoff(player, child) - GetPayoff(p_action));
+    deriv += GetRealizProb(member) * DiffNodeValue(child, player, p_oppAction);
   }
 
   return deriv / GetInfosetProb(p_action->GetInfoset());
@@ -445,7 +483,7 @@ T MixedBehaviorProfile<T>::DiffNodeValue(const GameNode &p_node, const GamePlaye
       // We've encountered the action; since we assume perfect recall,
       // we won't encounter it again, and the downtree value must
       // be the same.
-      return map_nodeValues[p_node->GetChild(p_oppAction)][p_player];
+      return GetPayoff(p_player, p_node->GetChild(p_oppAction));
     }
     else {
       T deriv = T(0);
@@ -467,99 +505,147 @@ T MixedBehaviorProfile<T>::DiffNodeValue(const GameNode &p_node, const GamePlaye
 //             MixedBehaviorProfile<T>: Cached profile information
 //========================================================================
 
-// compute realization probabilities for nodes and isets.
 template <class T>
-void MixedBehaviorProfile<T>::ComputePass1_realizProbs(const GameNode &node) const
+T MixedBehaviorProfile<T>::GetActionProb(const CompiledGameTree &p_tree, int p_node,
+                                         int p_action) const
 {
-  map_realizProbs[node] = (node->GetParent()) ? map_realizProbs[node->GetParent()] *
-                                                    GetActionProb(node->GetPriorAction())
-                                              : T(1);
-
-  for (auto childNode : node->GetChildren()) {
-    ComputePass1_realizProbs(childNode);
+  const int pl = p_tree.m_players[p_node];
+  if (pl == 0) {
+    return p_tree.GetChanceProb<T>(p_node, p_action);
   }
+  return m_actionProbs(pl, p_tree.m_infosets[p_node]->m_number, p_action);
 }
 
+// Parents precede children in the compiled tree, so a single forward sweep
+// computes realization probabilities, the sum of the payoffs on the path to
+// each node, and the realization probabilities of information sets.
 template <class T>
-void MixedBehaviorProfile<T>::ComputePass2_beliefs_nodeValues_actionValues(
-    const GameNode &node) const
+void MixedBehaviorProfile<T>::ComputeForwardSweep(const CompiledGameTree &p_tree) const
 {
-  if (node->GetOutcome()) {
-    GameOutcome outcome = node->GetOutcome();
-    for (auto player : m_support.GetGame()->GetPlayers()) {
-      map_nodeValues[node][player] += static_cast<T>(outcome->GetPayoff(player));
+  const int numPlayers = p_tree.m_numPlayers;
+  for (int node = 0; node < p_tree.NumNodes(); node++) {
+    T *values = &m_nodeValues[node * numPlayers];
+    if (p_tree.m_parents[node] >= 0) {
+      std::copy_n(&m_nodeValues[p_tree.m_parents[node] * numPlayers], numPlayers, values);
+    }
+    if (p_tree.m_outcomes[node]) {
+      for (int pl = 1; pl <= numPlayers; pl++) {
+        values[pl - 1] += p_tree.GetPayoff<T>(node, pl);
+      }
+    }
+    if (p_tree.m_infosetIds[node] < 0) {
+      continue;
+    }
+    const T &prob = m_realizProbs[node];
+    m_infosetProbs[p_tree.m_infosetIds[node]] += prob;
+    for (int k = p_tree.m_childStart[node], act = 1; k < p_tree.m_childStart[node + 1];
+         k++, act++) {
+      m_realizProbs[p_tree.m_children[k]] = prob * GetActionProb(p_tree, node, act);
     }
   }
+}
 
-  if (node->IsTerminal()) {
-    return;
-  }
-
-  GameInfoset iset = node->GetInfoset();
-  auto nodes = iset->GetMembers();
-  T infosetProb =
-      std::accumulate(nodes.begin(), nodes.end(), T(0),
-                      [this](T total, GameNode node) { return total + map_realizProbs[node]; });
-
-  if (infosetProb != T(0)) {
-    map_beliefs[node] = map_realizProbs[node] / infosetProb;
-  }
-
-  // push down payoffs from outcomes attached to non-terminal nodes
-  for (auto child : node->GetChildren()) {
-    map_nodeValues[child] = map_nodeValues[node];
-  }
-
-  for (auto player : m_support.GetGame()->GetPlayers()) {
-    map_nodeValues[node][player] = T(0);
+// Children follow their parents, so sweeping backwards replaces the path
+// payoffs at interior nodes by expected values.
+template <class T>
+void MixedBehaviorProfile<T>::ComputeBackwardSweep(const CompiledGameTree &p_tree) const
+{
+  const int numPlayers = p_tree.m_numPlayers;
+  for (int node = p_tree.NumNodes() - 1; node >= 0; node--) {
+    if (p_tree.m_infosetIds[node] < 0) {
+      continue;
+    }
+    T *values = &m_nodeValues[node * numPlayers];
+    std::fill_n(values, numPlayers, T(0));
+    for (int k = p_tree.m_childStart[node], act = 1; k < p_tree.m_childStart[node + 1];
+         k++, act++) {
+      const T *childValues = &m_nodeValues[p_tree.m_children[k] * numPlayers];
+      const T prob = GetActionProb(p_tree, node, act);
+      for (int pl = 0; pl < numPlayers; pl++) {
+        values[pl] += prob * childValues[pl];
+      }
+    }
   }
+}
 
-  for (auto child : node->GetChildren()) {
-    ComputePass2_beliefs_nodeValues_actionValues(child);
-
-    GameAction act = child->GetPriorAction();
-
-    for (auto player : m_support.GetGame()->GetPlayers()) {
-      map_nodeValues[node][player] += GetActionProb(act) * map_nodeValues[child][player];
+// Beliefs and action values are taken in a forward sweep, so that the members
+// of an information set contribute to action values in the order of the nodes.
+template <class T>
+void MixedBehaviorProfile<T>::ComputeBeliefs_actionValues(const CompiledGameTree &p_tree) const
+{
+  const int numPlayers = p_tree.m_numPlayers;
+  for (int node = 0; node < p_tree.NumNodes(); node++) {
+    if (p_tree.m_infosetIds[node] < 0) {
+      continue;
+    }
+    const T &infosetProb = m_infosetProbs[p_tree.m_infosetIds[node]];
+    if (infosetProb != T(0)) {
+      m_beliefs[node] = m_realizProbs[node] / infosetProb;
     }
 
-    if (!iset->IsChanceInfoset()) {
-      map_actionValues[act] += (infosetProb != T(0))
-                                   ? map_beliefs[node] * map_nodeValues[child][iset->GetPlayer()]
-                                   : T(0);
+    const int owner = p_tree.m_players[node];
+    if (owner == 0) {
+      continue;
+    }
+    const int iset = p_tree.m_infosets[node]->m_number;
+    for (int k = p_tree.m_childStart[node], act = 1; k < p_tree.m_childStart[node + 1];
+         k++, act++) {
+      m_actionValues(owner, iset, act) +=
+          m_beliefs[node] * m_nodeValues[p_tree.m_children[k] * numPlayers + owner - 1];
     }
   }
 }
 
-template <class T> void MixedBehaviorProfile<T>::ComputePass3_infosetValues_regret() const
+template <class T> void MixedBehaviorProfile<T>::ComputeInfosetValues_regret() const
 {
-  // Populate
-  for (auto infoset : m_support.GetGame()->GetInfosets()) {
-    map_infosetValues[infoset] = T(0);
-    for (auto action : infoset->GetActions()) {
-      map_infosetValues[infoset] += GetActionProb(action) * map_actionValues[action];
-    }
-    auto actions = infoset->GetActions();
-    T brpayoff = map_actionValues[actions.front()];
-    for (auto action : infoset->GetActions()) {
-      brpayoff = std::max(brpayoff, map_actionValues[action]);
-    }
-    for (auto action : infoset->GetActions()) {
-      map_regret[action] = brpayoff - map_actionValues[action];
+  for (auto player : m_support.GetGame()->GetPlayers()) {
+    const int pl = player->GetNumber();
+    for (int iset = 1; iset <= player->NumInfosets(); iset++) {
+      const int numActions = player->GetInfoset(iset)->NumActions();
+      T &infosetValue = m_infosetValues(pl, iset);
+      infosetValue = T(0);
+      T brpayoff = m_actionValues(pl, iset, 1);
+      for (int act = 1; act <= numActions; act++) {
+        infosetValue += m_actionProbs(pl, iset, act) * m_actionValues(pl, iset, act);
+        brpayoff = std::max(brpayoff, m_actionValues(pl, iset, act));
+      }
+      for (int act = 1; act <= numActions; act++) {
+        m_regret(pl, iset, act) = brpayoff - m_actionValues(pl, iset, act);
+      }
     }
   }
 }
 
 template <class T> void MixedBehaviorProfile<T>::ComputeSolutionData() const
 {
-  auto rootNode = m_support.GetGame()->GetRoot();
-  if (contains(map_realizProbs, rootNode)) {
+  if (m_cacheValid) {
     // cache is valid, don't compute anything, simply return
     return;
   }
-  ComputePass1_realizProbs(rootNode);
-  ComputePass2_beliefs_nodeValues_actionValues(rootNode);
-  ComputePass3_infosetValues_regret();
+  Game game = m_support.GetGame();
+  for (auto player : game->GetPlayers()) {
+    for (auto infoset : player->GetInfosets()) {
+      for (auto action : infoset->GetActions()) {
+        m_actionProbs(player->GetNumber(), infoset->GetNumber(), action->GetNumber()) =
+            GetActionProb(action);
+      }
+    }
+  }
+
+  const CompiledGameTree &tree = dynamic_cast<GameTreeRep &>(*game).GetCompiledTree();
+  const size_t numNodes = tree.NumNodes();
+  m_realizProbs.assign(numNodes, T(0));
+  m_beliefs.assign(numNodes, T(0));
+  m_nodeValues.assign(numNodes * game->NumPlayers(), T(0));
+  m_infosetProbs.assign(tree.m_numInfosets, T(0));
+  static_cast<Vector<T> &>(m_actionValues) = T(0);
+
+  m_realizProbs[0] = T(1);
+  ComputeForwardSweep(tree);
+  ComputeBackwardSweep(tree);
+  ComputeBeliefs_actionValues(tree);
+  ComputeInfosetValues_regret();
+  m_cacheValid = true;
 }
 
 template <class T> bool MixedBehaviorProfile<T>::IsDefinedAt(GameInfoset p_infoset) const
@@ -37,23 +37,37 @@ protected:
   BehaviorSupportProfile m_support;
   unsigned int m_gameversion;
 
-  // structures for storing cached data: nodes
-  mutable std::map<GameNode, T> map_realizProbs, map_beliefs;
-  mutable std::map<GameNode, std::map<GamePlayer, T>> map_nodeValues;
+  // structures for storing cached data: nodes, indexed by node number
+  mutable std::vector<T> m_realizProbs, m_beliefs;
+  /// Values of the nodes to each player, stored node-major with one entry per player
+  mutable std::vector<T> m_nodeValues;
+  /// Realization probabilities of the information sets, indexed as in the compiled tree
+  mutable std::vector<T> m_infosetProbs;
 
   // structures for storing cached data: information sets
-  mutable std::map<GameInfoset, T> map_infosetValues;
+  mutable PVector<T> m_infosetValues;
 
   // structures for storing cached data: actions
-  mutable std::map<GameAction, T> map_actionValues; // aka conditional payoffs
-  mutable std::map<GameAction, T> map_regret;
+  mutable DVector<T> m_actionProbs;  // probabilities of all actions, including unsupported
+  mutable DVector<T> m_actionValues; // aka conditional payoffs
+  mutable DVector<T> m_regret;
+
+  mutable bool m_cacheValid{false};
 
   /// @name Auxiliary functions for computation of interesting values
   //@{
   void GetPayoff(const GameNode &, const T &, const GamePlayer &, T &) const;
-  void ComputePass1_realizProbs(const GameNode &node) const;
-  void ComputePass2_beliefs_nodeValues_actionValues(const GameNode &node) const;
-  void ComputePass3_infosetValues_regret() const;
+  /// Returns the probability of the p_action'th action at the p_node'th node of
+  /// the compiled tree, looking up chance probabilities from the game and others
+  /// from the cache
+  T GetActionProb(const class CompiledGameTree &p_tree, int p_node, int p_action) const;
+  /// Computes realization probabilities and path payoffs in a forward sweep of the tree
+  void ComputeForwardSweep(const class CompiledGameTree &p_tree) const;
+  /// Computes node values in a backward sweep of the tree
+  void ComputeBackwardSweep(const class CompiledGameTree &p_tree) const;
+  /// Computes beliefs and action values in a forward sweep of the tree
+  void ComputeBeliefs_actionValues(const class CompiledGameTree &p_tree) const;
+  void ComputeInfosetValues_regret() const;
   void ComputeSolutionData() const;
   //@}
 
@@ -130,18 +144,7 @@ public:
   /// @name Initialization, validation
   //@{
   /// Force recomputation of stored quantities
-  /// The validity of all caches is determined by the existence of the root node in the
-  /// primary cache (first to be computed) map_realizProbs
-  /// We also clear
-  /// map_nodeValues, map_actionValues
-  /// as otherwise we would need to reset them to 0 while populating them
-  void InvalidateCache() const
-  {
-    map_realizProbs.clear();
-    map_nodeValues.clear();
-    map_actionValues.clear();
-  }
-  /// Reset certain cached values
+  void InvalidateCache() const { m_cacheValid = false; }
 
   /// Set the profile to the centroid
   void SetCentroid();
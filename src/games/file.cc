@@ -534,7 +534,7 @@ void ReadOutcomeList(GameParserState &p_parser, Game &p_nfg)
 
     try {
       while (p_parser.GetCurrentToken() == TOKEN_NUMBER) {
-        outcome->SetPayoff(pl++, Number(p_parser.GetLastText()));
+        outcome->SetPayoff(pl++, p_parser.GetLastText());
         if (p_parser.GetNextToken() == TOKEN_COMMA) {
           p_parser.GetNextToken();
         }
@@ -591,7 +591,7 @@ void ParsePayoffBody(GameParserState &p_parser, Game &p_nfg)
 
   while (p_parser.GetCurrentToken() != TOKEN_EOF) {
     if (p_parser.GetCurrentToken() == TOKEN_NUMBER) {
-      (*iter)->GetOutcome()->SetPayoff(pl, Number(p_parser.GetLastText()));
+      (*iter)->GetOutcome()->SetPayoff(pl, p_parser.GetLastText());
     }
     else {
       throw InvalidFileException(p_parser.CreateLineMsg("Expecting payoff"));
@@ -704,7 +704,7 @@ void ParseOutcome(GameParserState &p_state, Game &p_game, TreeData &p_treeData,
 
     for (int pl = 1; pl <= p_game->NumPlayers(); pl++) {
       if (p_state.GetCurrentToken() == TOKEN_NUMBER) {
-        outcome->SetPayoff(pl, Number(p_state.GetLastText()));
+        outcome->SetPayoff(pl, p_state.GetLastText());
       }
       else {
         throw InvalidFileException(p_state.CreateLineMsg("Payoffs should be numbers"));
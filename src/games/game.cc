@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <numeric>
 #include <random>
+#include <type_traits>
 
 #include "gambit.h"
 
@@ -43,6 +44,9 @@ namespace Gambit {
 GameOutcomeRep::GameOutcomeRep(GameRep *p_game, int p_number)
   : m_game(p_game), m_number(p_number), m_payoffs(m_game->NumPlayers())
 {
+  for (auto &payoff : m_payoffs) {
+    payoff = m_game->m_numbers.Zero();
+  }
 }
 
 //========================================================================
@@ -63,7 +67,10 @@ void GameStrategyRep::DeleteStrategy()
   for (int st = 1; st <= m_player->m_strategies.Length(); st++) {
     m_player->m_strategies[st]->m_number = st;
   }
-  // m_player->m_game->RebuildTable();
+  if (auto *table = dynamic_cast<GameTableRep *>(m_player->m_game)) {
+    // Re-lay out the table so strategy offsets index it contiguously
+    table->RebuildTable();
+  }
   this->Invalidate();
 }
 
@@ -361,9 +368,70 @@ template <class T> MixedStrategyProfileRep<T> *MixedStrategyProfileRep<T>::Norma
       (*norm)[strategy] /= sum;
     }
   }
+  // The probabilities were changed through the representation directly, so any
+  // values cached by the copy are out of date
+  norm->InvalidateCache();
   return norm;
 }
 
+template <class T> Vector<T> MixedStrategyProfileRep<T>::GetPayoffs() const
+{
+  Vector<T> payoffs(m_support.GetGame()->NumPlayers());
+  for (int pl = 1; pl <= payoffs.Length(); pl++) {
+    payoffs[pl] = GetPayoff(pl);
+  }
+  return payoffs;
+}
+
+template <class T> PVector<T> MixedStrategyProfileRep<T>::GetStrategyValues() const
+{
+  Game game = m_support.GetGame();
+  PVector<T> values(game->NumStrategies());
+  for (auto player : game->GetPlayers()) {
+    for (auto strategy : player->GetStrategies()) {
+      values(player->GetNumber(), strategy->GetNumber()) =
+          GetPayoffDeriv(player->GetNumber(), strategy);
+    }
+  }
+  return values;
+}
+
+template <class T>
+PVector<T> MixedStrategyProfileRep<T>::GetStrategyValueChanges(int p_player,
+                                                              const Vector<T> &p_delta) const
+{
+  // Without a representation-specific shortcut, the values are computed in full
+  // before and after the change
+  Game game = m_support.GetGame();
+  GamePlayer player = game->GetPlayer(p_player);
+  std::unique_ptr<MixedStrategyProfileRep<T>> changed(Copy());
+  for (int st = 1; st <= p_delta.Length(); st++) {
+    if (p_delta[st] != T(0)) {
+      (*changed)[player->GetStrategy(st)] += p_delta[st];
+    }
+  }
+  changed->InvalidateCache();
+  PVector<T> changes = changed->GetStrategyValues();
+  changes -= GetStrategyValues();
+  for (int st = 1; st <= player->NumStrategies(); st++) {
+    changes(p_player, st) = T(0);
+  }
+  return changes;
+}
+
+template <class T> Matrix<T> MixedStrategyProfileRep<T>::GetStrategyValueDerivs() const
+{
+  auto strategies = m_support.GetGame()->GetStrategies();
+  Matrix<T> derivs(strategies.size(), strategies.size());
+  for (auto strategy1 : strategies) {
+    for (auto strategy2 : strategies) {
+      derivs(strategy1->GetId(), strategy2->GetId()) =
+          GetPayoffDeriv(strategy1->GetPlayer()->GetNumber(), strategy1, strategy2);
+    }
+  }
+  return derivs;
+}
+
 template <class T> T MixedStrategyProfileRep<T>::GetRegret(const GameStrategy &p_strategy) const
 {
   GamePlayer player = p_strategy->GetPlayer();
@@ -390,11 +458,17 @@ template <class T> T MixedStrategyProfileRep<T>::GetRegret(const GamePlayer &p_p
 
 template <class T> T MixedStrategyProfileRep<T>::GetMaxRegret() const
 {
-  auto players = m_support.GetGame()->GetPlayers();
-  return std::accumulate(players.begin(), players.end(), T(0),
-                         [this](const T &x, const GamePlayer &player) {
-                           return std::max(x, this->GetRegret(player));
-                         });
+  Vector<T> payoffs = GetPayoffs();
+  PVector<T> values = GetStrategyValues();
+  T max_regret = T(0);
+  for (int pl = 1; pl <= payoffs.Length(); pl++) {
+    T br_payoff = values(pl, 1);
+    for (int st = 2; st <= values.Lengths()[pl]; st++) {
+      br_payoff = std::max(br_payoff, values(pl, st));
+    }
+    max_regret = std::max(max_regret, br_payoff - payoffs[pl]);
+  }
+  return max_regret;
 }
 
 //========================================================================
@@ -461,6 +535,92 @@ template <class T> Vector<T> MixedStrategyProfile<T>::operator[](const GamePlaye
   return probs;
 }
 
+template <class T>
+void MixedStrategyProfile<T>::IncrementStrategyProbs(const GamePlayer &p_player,
+                                                     const Vector<T> &p_delta)
+{
+  CheckVersion();
+  if (p_player->GetGame() != GetGame()) {
+    throw MismatchException();
+  }
+  if (p_delta.Length() != p_player->NumStrategies()) {
+    throw DimensionException();
+  }
+  for (int st = 1; st <= p_delta.Length(); st++) {
+    if (p_delta[st] != T(0) && !m_rep->m_support.Contains(p_player->GetStrategy(st))) {
+      throw UndefinedException("Cannot change the probability of a strategy not in the support");
+    }
+  }
+
+  bool cacheValid = m_cacheValid;
+  if (!m_rep->HasFastStrategyValueChanges()) {
+    // Correcting the cache would cost more than computing it in full when next needed
+    m_cacheValid = cacheValid = false;
+  }
+  if constexpr (std::is_same<T, double>::value) {
+    // Each correction adds a rounding error of the order of the machine epsilon
+    // relative to the payoffs, so the cache is discarded periodically, to be
+    // computed in full when next needed.  After 100 corrections the accumulated
+    // error (about 1e-14 relative) is still well below the tolerances of the
+    // solvers, while spreading the full computation over 100 corrections adds
+    // only 1% of its cost to each.
+    const int c_maxIncrements = 100;
+    if (cacheValid && ++m_numIncrements > c_maxIncrements) {
+      m_cacheValid = cacheValid = false;
+    }
+  }
+  if (cacheValid) {
+    // The changes must be computed against the profile before it is updated
+    PVector<T> changes = m_rep->GetStrategyValueChanges(p_player->GetNumber(), p_delta);
+    for (auto player : GetGame()->GetPlayers()) {
+      if (player != p_player) {
+        for (auto strategy : player->GetStrategies()) {
+          m_strategyValues[strategy->GetId() - 1] +=
+              changes(player->GetNumber(), strategy->GetNumber());
+        }
+      }
+    }
+  }
+
+  for (int st = 1; st <= p_delta.Length(); st++) {
+    if (p_delta[st] != T(0)) {
+      (*m_rep)[p_player->GetStrategy(st)] += p_delta[st];
+    }
+  }
+  m_rep->InvalidateCache();
+
+  if (cacheValid) {
+    UpdatePayoffs();
+  }
+}
+
+template <class T>
+void MixedStrategyProfile<T>::SetStrategyProbs(const GamePlayer &p_player,
+                                               const Vector<T> &p_probs)
+{
+  CheckVersion();
+  if (p_player->GetGame() != GetGame()) {
+    throw MismatchException();
+  }
+  if (p_probs.Length() != p_player->NumStrategies()) {
+    throw DimensionException();
+  }
+  Vector<T> delta(p_probs);
+  for (int st = 1; st <= p_probs.Length(); st++) {
+    GameStrategy strategy = p_player->GetStrategy(st);
+    if (m_rep->m_support.Contains(strategy)) {
+      delta[st] -= (*m_rep)[strategy];
+    }
+  }
+  IncrementStrategyProbs(p_player, delta);
+  // Adding the changes may round the probabilities; store them as given
+  for (int st = 1; st <= p_probs.Length(); st++) {
+    if (delta[st] != T(0)) {
+      (*m_rep)[p_player->GetStrategy(st)] = p_probs[st];
+    }
+  }
+}
+
 template <class T> MixedStrategyProfile<T> MixedStrategyProfile<T>::ToFullSupport() const
 {
   CheckVersion();
@@ -484,21 +644,66 @@ template <class T> MixedStrategyProfile<T> MixedStrategyProfile<T>::ToFullSuppor
 //========================================================================
 //    MixedStrategyProfile<T>: Computation of interesting quantities
 //========================================================================
+template <class T> void MixedStrategyProfile<T>::UpdatePayoffs() const
+{
+  for (auto player : m_rep->m_support.GetPlayers()) {
+    T payoff = T(0);
+    for (auto strategy : m_rep->m_support.GetStrategies(player)) {
+      payoff += (*m_rep)[strategy] * m_strategyValues[strategy->GetId() - 1];
+    }
+    m_payoffs[player->GetNumber() - 1] = payoff;
+  }
+}
+
 template <class T> void MixedStrategyProfile<T>::ComputePayoffs() const
 {
-  if (!map_profile_payoffs.empty()) {
-    // caches (map_profile_payoffs and map_strategy_payoffs) are valid,
+  if (m_cacheValid) {
+    // caches (m_payoffs and m_strategyValues) are valid,
     // so don't compute anything, simply return
     return;
   }
-  for (auto player : m_rep->m_support.GetPlayers()) {
-    map_profile_payoffs[player] = GetPayoff(player);
+  Game game = m_rep->m_support.GetGame();
+  PVector<T> values = m_rep->GetStrategyValues();
+  m_payoffs.resize(game->NumPlayers());
+  m_strategyValues.resize(game->MixedProfileLength());
+  for (auto player : game->GetPlayers()) {
     // values of the player's strategies
-    for (auto strategy : m_rep->m_support.GetStrategies(player)) {
-      map_strategy_payoffs[player][strategy] = GetPayoff(strategy);
+    for (auto strategy : player->GetStrategies()) {
+      m_strategyValues[strategy->GetId() - 1] =
+          values(player->GetNumber(), strategy->GetNumber());
     }
   }
-};
+  // each player's payoff is the mean of the values of their strategies
+  UpdatePayoffs();
+  m_cacheValid = true;
+  m_numIncrements = 0;
+}
+
+template <class T> Vector<T> MixedStrategyProfile<T>::GetPayoffs() const
+{
+  CheckVersion();
+  if (!m_cacheValid) {
+    return m_rep->GetPayoffs();
+  }
+  Vector<T> payoffs(m_payoffs.size());
+  std::copy(m_payoffs.cbegin(), m_payoffs.cend(), payoffs.begin());
+  return payoffs;
+}
+
+template <class T> PVector<T> MixedStrategyProfile<T>::GetStrategyValues() const
+{
+  CheckVersion();
+  ComputePayoffs();
+  Game game = m_rep->m_support.GetGame();
+  PVector<T> values(game->NumStrategies());
+  for (auto player : game->GetPlayers()) {
+    for (auto strategy : player->GetStrategies()) {
+      values(player->GetNumber(), strategy->GetNumber()) =
+          m_strategyValues[strategy->GetId() - 1];
+    }
+  }
+  return values;
+}
 
 template <class T> T MixedStrategyProfile<T>::GetLiapValue() const
 {
@@ -507,8 +712,8 @@ template <class T> T MixedStrategyProfile<T>::GetLiapValue() const
 
   T liapValue = T(0);
   for (auto player : m_rep->m_support.GetPlayers()) {
-    for (auto v : map_strategy_payoffs[player]) {
-      T regret = v.second - map_profile_payoffs[player];
+    for (auto strategy : m_rep->m_support.GetStrategies(player)) {
+      T regret = m_strategyValues[strategy->GetId() - 1] - m_payoffs[player->GetNumber() - 1];
       if (regret > T(0)) {
         liapValue += regret * regret; // penalty if not best response
       }
@@ -122,7 +122,7 @@ private:
   GameRep *m_game;
   int m_number;
   std::string m_label;
-  Array<Number> m_payoffs;
+  Array<const Number *> m_payoffs;
 
   /// @name Lifecycle
   //@{
@@ -145,11 +145,13 @@ public:
   void SetLabel(const std::string &p_label) { m_label = p_label; }
 
   /// Gets the payoff associated with the outcome to player 'pl'
-  const Number &GetPayoff(int pl) const { return m_payoffs[pl]; }
+  const Number &GetPayoff(int pl) const { return *m_payoffs[pl]; }
   /// Gets the payoff associated with the outcome to the player
   const Number &GetPayoff(const GamePlayer &p_player) const;
   /// Sets the payoff to player 'pl'
   void SetPayoff(int pl, const Number &p_value);
+  /// Sets the payoff to player 'pl' to the value with text representation p_text
+  void SetPayoff(int pl, const std::string &p_text);
   /// Sets the payoff to the player
   void SetPayoff(const GamePlayer &p_player, const Number &p_value);
   //@}
@@ -236,6 +238,7 @@ class GameStrategyRep : public GameObject {
   friend class StrategySupportProfile;
   template <class T> friend class MixedStrategyProfile;
   template <class T> friend class TableMixedStrategyProfileRep;
+  template <class T> friend class TreeMixedStrategyProfileRep;
   template <class T> friend class MixedBehaviorProfile;
 
 private:
@@ -411,6 +414,8 @@ class GameRep : public BaseGameRep {
 protected:
   std::string m_title, m_comment;
   unsigned int m_version;
+  /// The distinct values of the payoffs of outcomes
+  NumberStore m_numbers;
 
   GameRep() : m_version(0) {}
 
@@ -570,6 +575,8 @@ public:
   virtual GameOutcome NewOutcome() = 0;
   /// Deletes the specified outcome from the game
   virtual void DeleteOutcome(const GameOutcome &) = 0;
+  /// Returns the number of distinct payoff values held by the game
+  size_t NumPayoffValues() const { return m_numbers.NumValues(); }
   //@}
 
   /// @name Nodes
@@ -600,13 +607,23 @@ inline const Number &GameOutcomeRep::GetPayoff(const GamePlayer &p_player) const
   if (p_player->GetGame() != GetGame()) {
     throw MismatchException();
   }
-  return m_payoffs[p_player->GetNumber()];
+  return *m_payoffs[p_player->GetNumber()];
 }
 
 inline void GameOutcomeRep::SetPayoff(int pl, const Number &p_value)
 {
   m_game->IncrementVersion();
-  m_payoffs[pl] = p_value;
+  const Number *value = m_game->m_numbers.Intern(p_value);
+  m_game->m_numbers.Release(m_payoffs[pl]);
+  m_payoffs[pl] = value;
+}
+
+inline void GameOutcomeRep::SetPayoff(int pl, const std::string &p_text)
+{
+  m_game->IncrementVersion();
+  const Number *value = m_game->m_numbers.Intern(p_text);
+  m_game->m_numbers.Release(m_payoffs[pl]);
+  m_payoffs[pl] = value;
 }
 
 inline void GameOutcomeRep::SetPayoff(const GamePlayer &p_player, const Number &p_value)
@@ -614,8 +631,7 @@ inline void GameOutcomeRep::SetPayoff(const GamePlayer &p_player, const Number &
   if (p_player->GetGame() != GetGame()) {
     throw MismatchException();
   }
-  m_game->IncrementVersion();
-  m_payoffs[p_player->GetNumber()] = p_value;
+  SetPayoff(p_player->GetNumber(), p_value);
 }
 
 inline GamePlayer GameStrategyRep::GetPlayer() const { return m_player; }
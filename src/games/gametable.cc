@@ -21,6 +21,14 @@
 //
 
 #include <iostream>
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
 
 #include "gambit.h"
 #include "gametable.h"
@@ -86,7 +94,9 @@ GameOutcome TablePureStrategyProfileRep::GetOutcome() const
 
 void TablePureStrategyProfileRep::SetOutcome(GameOutcome p_outcome)
 {
-  dynamic_cast<GameTableRep &>(*m_nfg).m_results[m_index] = p_outcome;
+  auto &game = dynamic_cast<GameTableRep &>(*m_nfg);
+  game.m_results[m_index] = p_outcome;
+  game.UpdatePayoffTables(m_index);
 }
 
 Rational TablePureStrategyProfileRep::GetPayoff(int pl) const
@@ -119,23 +129,348 @@ PureStrategyProfile GameTableRep::NewPureStrategyProfile() const
   return PureStrategyProfile(new TablePureStrategyProfileRep(const_cast<GameTableRep *>(this)));
 }
 
+//========================================================================
+//                           class WorkerPool
+//========================================================================
+
+///
+/// A fixed set of threads, started once and reused for each computation
+/// divided among them, so that short computations do not pay for starting
+/// threads.  The calling thread always does a share of the work itself.
+///
+class WorkerPool {
+public:
+  using Task = std::function<void(long, long)>;
+
+  /// Start p_threads - 1 threads, to work alongside the calling thread
+  explicit WorkerPool(int p_threads);
+  WorkerPool(const WorkerPool &) = delete;
+  ~WorkerPool();
+
+  WorkerPool &operator=(const WorkerPool &) = delete;
+
+  /// Returns the number of threads, including the calling thread
+  int NumThreads() const { return static_cast<int>(m_workers.size()) + 1; }
+  /// Divides [0, p_size) into consecutive ranges, one for each of up to p_threads
+  /// threads, and calls p_task(begin, end) on each, returning when all are done.
+  /// The first range is handled by the calling thread.  Calls from different
+  /// threads are handled one at a time.
+  void ParallelFor(long p_size, long p_threads, const Task &p_task);
+
+private:
+  std::vector<std::thread> m_workers;
+  std::mutex m_callMutex, m_mutex;
+  std::condition_variable m_started, m_finished;
+  const Task *m_task{nullptr};
+  long m_size{0}, m_numRanges{0};
+  unsigned long m_generation{0};
+  int m_pending{0};
+  bool m_stopping{false};
+  std::exception_ptr m_error;
+
+  /// The loop run by the p_worker'th thread (numbered from 1)
+  void Run(int p_worker);
+};
+
+WorkerPool::WorkerPool(int p_threads)
+{
+  for (int t = 1; t < p_threads; t++) {
+    m_workers.emplace_back(&WorkerPool::Run, this, t);
+  }
+}
+
+WorkerPool::~WorkerPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stopping = true;
+  }
+  m_started.notify_all();
+  for (auto &worker : m_workers) {
+    worker.join();
+  }
+}
+
+void WorkerPool::Run(int p_worker)
+{
+  unsigned long generation = 0;
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true) {
+    m_started.wait(lock, [&]() { return m_stopping || m_generation != generation; });
+    if (m_stopping) {
+      return;
+    }
+    generation = m_generation;
+    if (p_worker >= m_numRanges) {
+      continue;
+    }
+    const Task &task = *m_task;
+    const long begin = m_size * p_worker / m_numRanges;
+    const long end = m_size * (p_worker + 1) / m_numRanges;
+    lock.unlock();
+    std::exception_ptr error;
+    try {
+      task(begin, end);
+    }
+    catch (...) {
+      error = std::current_exception();
+    }
+    lock.lock();
+    if (error && !m_error) {
+      m_error = error;
+    }
+    if (--m_pending == 0) {
+      m_finished.notify_one();
+    }
+  }
+}
+
+void WorkerPool::ParallelFor(long p_size, long p_threads, const Task &p_task)
+{
+  const long threads = std::min({p_threads, p_size, static_cast<long>(NumThreads())});
+  if (threads <= 1) {
+    p_task(0L, p_size);
+    return;
+  }
+  std::lock_guard<std::mutex> call(m_callMutex);
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_task = &p_task;
+    m_size = p_size;
+    m_numRanges = threads;
+    m_pending = static_cast<int>(threads) - 1;
+    m_error = nullptr;
+    m_generation++;
+  }
+  m_started.notify_all();
+  std::exception_ptr error;
+  try {
+    p_task(0L, p_size / threads);
+  }
+  catch (...) {
+    error = std::current_exception();
+  }
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_finished.wait(lock, [&]() { return m_pending == 0; });
+  if (!error) {
+    error = m_error;
+  }
+  m_task = nullptr;
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
 //========================================================================
 //                   TableMixedStrategyProfileRep<T>
 //========================================================================
 
+namespace {
+
+/// Contracts a tensor along one of its axes.
+/// The tensor p_tensor is viewed as having dimensions (p_inner, p_dim, p_outer),
+/// with the first index varying fastest.  The axis of length p_dim is summed out,
+/// weighting its entries by p_weights, and the entries of the resulting tensor of
+/// dimensions (p_inner, p_outer) whose first index is in [p_begin, p_end)
+/// are written to p_result.
+template <class T>
+void ContractAxis(const T *p_tensor, long p_inner, int p_dim, long p_outer, const T *p_weights,
+                  T *p_result, long p_begin, long p_end)
+{
+  if (p_inner == 1) {
+    // The contracted axis is the fastest-varying one: each entry is a dot product
+    for (long b = 0; b < p_outer; b++, p_tensor += p_dim) {
+      T sum = static_cast<T>(0);
+      for (int s = 0; s < p_dim; s++) {
+        sum += p_weights[s] * p_tensor[s];
+      }
+      p_result[b] = sum;
+    }
+    return;
+  }
+
+  for (long b = 0; b < p_outer; b++, p_result += p_inner) {
+    std::fill(p_result + p_begin, p_result + p_end, static_cast<T>(0));
+    for (int s = 0; s < p_dim; s++, p_tensor += p_inner) {
+      const T &weight = p_weights[s];
+      if (weight == static_cast<T>(0)) {
+        continue;
+      }
+      for (long a = p_begin; a < p_end; a++) {
+        p_result[a] += weight * p_tensor[a];
+      }
+    }
+  }
+}
+
+/// The smallest number of table entries worth handing to a thread of its own
+const long MinEntriesPerThread = 1L << 16;
+
+/// Contracts a tensor along one of its axes, as above, dividing the entries of
+/// the result among the threads of p_pool, if not null.  Each entry is computed
+/// by a single thread, summing in the same order as the serial computation, so
+/// the result does not depend on the number of threads.
+template <class T>
+void ContractAxis(const T *p_tensor, long p_inner, int p_dim, long p_outer, const T *p_weights,
+                  T *p_result, WorkerPool *p_pool)
+{
+  long threads = (p_pool) ? std::min(static_cast<long>(p_pool->NumThreads()),
+                                     p_inner * p_dim * p_outer / MinEntriesPerThread)
+                          : 1L;
+  if (p_inner == 1) {
+    threads = std::min(threads, p_outer);
+  }
+  if (threads <= 1) {
+    ContractAxis(p_tensor, p_inner, p_dim, p_outer, p_weights, p_result, 0, p_inner);
+  }
+  else if (p_outer >= threads) {
+    // Divide the blocks among the threads
+    p_pool->ParallelFor(p_outer, threads, [=](long p_first, long p_last) {
+      ContractAxis(p_tensor + p_first * p_dim * p_inner, p_inner, p_dim, p_last - p_first,
+                   p_weights, p_result + p_first * p_inner, 0, p_inner);
+    });
+  }
+  else {
+    // Too few blocks to go around; divide each block instead
+    p_pool->ParallelFor(p_inner, threads, [=](long p_begin, long p_end) {
+      ContractAxis(p_tensor, p_inner, p_dim, p_outer, p_weights, p_result, p_begin, p_end);
+    });
+  }
+}
+
+/// Sums p_blocks consecutive payoff tables over the strategies of all players
+/// other than p_keep1 and p_keep2 (if nonzero), weighted by their probabilities
+/// in p_probs.  Floating-point contractions use the threads of p_pool, if not null.
+/// The dimensions of the tables are those of p_probs.  The result is indexed by the
+/// strategies of the kept players, in table order, and then by block.
+template <class T>
+std::vector<T> ContractTables(const Array<std::vector<T>> &p_probs, const T *p_table,
+                              long p_blocks, int p_keep1, int p_keep2, WorkerPool *p_pool)
+{
+  std::vector<T> current, next;
+  const T *source = p_table;
+  // Players are summed out beginning with the one whose axis varies slowest,
+  // so the innermost loops run over long contiguous stretches of the table.
+  long inner = 1, outer = p_blocks;
+  for (const auto &probs : p_probs) {
+    inner *= probs.size();
+  }
+  for (int pl = p_probs.size(); pl >= 1; pl--) {
+    int dim = p_probs[pl].size();
+    inner /= dim;
+    if (pl == p_keep1 || pl == p_keep2) {
+      outer *= dim;
+      continue;
+    }
+    next.resize(inner * outer);
+    if constexpr (std::is_same<T, double>::value) {
+      ContractAxis(source, inner, dim, outer, p_probs[pl].data(), next.data(), p_pool);
+    }
+    else {
+      // Exact contractions are always done on the calling thread, so that threads
+      // never share the arithmetic of Rational
+      ContractAxis(source, inner, dim, outer, p_probs[pl].data(), next.data(), 0L, inner);
+    }
+    std::swap(current, next);
+    source = current.data();
+  }
+  if (source == p_table) {
+    current.assign(p_table, p_table + outer);
+  }
+  return current;
+}
+
+/// Returns the value of each strategy, listed by player and then by strategy in
+/// table order, when the strategies are played with the probabilities p_probs.
+/// The payoff tables of the players, with the dimensions of p_probs, are stored
+/// consecutively from p_tables.
+template <class T>
+std::vector<T> TableStrategyValues(const Array<std::vector<T>> &p_probs, const T *p_tables,
+                                   WorkerPool *p_pool)
+{
+  long size = 1;
+  for (const auto &probs : p_probs) {
+    size *= probs.size();
+  }
+  const int numPlayers = p_probs.size();
+  std::vector<T> values;
+  for (int pl = 1; pl <= numPlayers; pl++) {
+    // Summing out all other players leaves the value of each of pl's strategies
+    auto player_values = ContractTables(p_probs, p_tables + (pl - 1) * size, 1, pl, 0, p_pool);
+    values.insert(values.end(), player_values.begin(), player_values.end());
+  }
+  return values;
+}
+
+/// Sets p_derivs to the derivatives of the value of each strategy with respect to the
+/// probability of each strategy, with rows and columns indexed as TableStrategyValues()
+/// lists the values.  The arguments are as for TableStrategyValues().
+template <class T>
+void TableStrategyValueDerivs(const Array<std::vector<T>> &p_probs, const T *p_tables,
+                              WorkerPool *p_pool, Matrix<T> &p_derivs)
+{
+  long size = 1;
+  for (const auto &probs : p_probs) {
+    size *= probs.size();
+  }
+  const int numPlayers = p_probs.size();
+  p_derivs = static_cast<T>(0);
+  int offset1 = 0;
+  for (int pl1 = 1; pl1 <= numPlayers; pl1++) {
+    const T *table = p_tables + (pl1 - 1) * size;
+    const int dim1 = p_probs[pl1].size();
+    int offset2 = 0;
+    for (int pl2 = 1; pl2 <= numPlayers; pl2++) {
+      const int dim2 = p_probs[pl2].size();
+      if (pl2 != pl1) {
+        // Summing out all players except pl1 and pl2 leaves one block of the matrix,
+        // with the strategies of the lower-numbered player varying fastest
+        auto block = ContractTables(p_probs, table, 1, pl1, pl2, p_pool);
+        for (int st1 = 0; st1 < dim1; st1++) {
+          for (int st2 = 0; st2 < dim2; st2++) {
+            p_derivs(offset1 + st1 + 1, offset2 + st2 + 1) =
+                (pl1 < pl2) ? block[st1 + dim1 * st2] : block[st2 + dim2 * st1];
+          }
+        }
+      }
+      offset2 += dim2;
+    }
+    offset1 += dim1;
+  }
+}
+
+} // end anonymous namespace
+
+
 template <class T> class TableMixedStrategyProfileRep : public MixedStrategyProfileRep<T> {
 private:
-  /// @name Private recursive payoff functions
+  /// @name Private payoff computation functions
   //@{
-  /// Recursive computation of payoff to player pl
-  T GetPayoff(int pl, int index, int i) const;
+  /// Returns the probabilities of each player's strategies, in the order
+  /// of the game table, with zero for strategies not in the support
+  Array<std::vector<T>> GetTableProbs() const;
+  /// Sums p_blocks consecutive payoff tables over the strategies of all players
+  /// other than p_keep1 and p_keep2 (if nonzero), weighted by their probabilities.
+  /// The dimensions of the tables are those of p_probs.
+  /// The result is indexed by the strategies of the kept players, in table order,
+  /// and then by block.
+  std::vector<T> Contract(const Array<std::vector<T>> &p_probs, const T *p_table,
+                          long p_blocks, int p_keep1 = 0, int p_keep2 = 0) const;
   /// Recursive computation of payoff derivative
-  void GetPayoffDeriv(int pl, int const_pl, int cur_pl, long index, const T &prob, T &value) const;
-  /// Recursive computation of payoff second derivative
-  void GetPayoffDeriv(int pl, int const_pl1, int const_pl2, int cur_pl, long index, const T &prob,
+  void GetPayoffDeriv(const T *p_payoffs, int const_pl, int cur_pl, long index, const T &prob,
                       T &value) const;
+  /// Recursive computation of payoff second derivative
+  void GetPayoffDeriv(const T *p_payoffs, int const_pl1, int const_pl2, int cur_pl, long index,
+                      const T &prob, T &value) const;
   //@}
 
+  /// Returns the dense payoff table for player pl
+  const T *GetPayoffTable(int pl) const
+  {
+    return dynamic_cast<GameTableRep &>(*this->m_support.GetGame()).template GetPayoffTable<T>(
+        pl);
+  }
+
 public:
   explicit TableMixedStrategyProfileRep(const StrategySupportProfile &p_support)
     : MixedStrategyProfileRep<T>(p_support)
@@ -145,8 +480,13 @@ public:
 
   MixedStrategyProfileRep<T> *Copy() const override;
   T GetPayoff(int pl) const override;
+  Vector<T> GetPayoffs() const override;
+  PVector<T> GetStrategyValues() const override;
   T GetPayoffDeriv(int pl, const GameStrategy &) const override;
   T GetPayoffDeriv(int pl, const GameStrategy &, const GameStrategy &) const override;
+  Matrix<T> GetStrategyValueDerivs() const override;
+  PVector<T> GetStrategyValueChanges(int p_player, const Vector<T> &p_delta) const override;
+  bool HasFastStrategyValueChanges() const override { return true; }
 };
 
 template <class T> MixedStrategyProfileRep<T> *TableMixedStrategyProfileRep<T>::Copy() const
@@ -154,54 +494,78 @@ template <class T> MixedStrategyProfileRep<T> *TableMixedStrategyProfileRep<T>::
   return new TableMixedStrategyProfileRep(*this);
 }
 
-template <class T>
-T TableMixedStrategyProfileRep<T>::GetPayoff(int pl, int index, int current) const
+template <class T> Array<std::vector<T>> TableMixedStrategyProfileRep<T>::GetTableProbs() const
 {
-  if (current > this->m_support.GetGame()->NumPlayers()) {
-    Game game = this->m_support.GetGame();
-    auto &g = dynamic_cast<GameTableRep &>(*game);
-    GameOutcomeRep *outcome = g.m_results[index];
-    if (outcome) {
-      return static_cast<T>(outcome->GetPayoff(pl));
-    }
-    else {
-      return T(0);
+  Game game = this->m_support.GetGame();
+  Array<std::vector<T>> probs(game->NumPlayers());
+  for (int pl = 1; pl <= game->NumPlayers(); pl++) {
+    GamePlayerRep *player = game->GetPlayer(pl);
+    probs[pl].assign(player->NumStrategies(), static_cast<T>(0));
+    for (auto strategy : this->m_support.GetStrategies(player)) {
+      probs[pl][strategy->GetNumber() - 1] = (*this)[strategy];
     }
   }
+  return probs;
+}
 
-  T sum = static_cast<T>(0);
-  for (auto s : this->m_support.GetStrategies(this->m_support.GetGame()->GetPlayer(current))) {
-    if ((*this)[s] != T(0)) {
-      sum += ((*this)[s] * GetPayoff(pl, index + s->m_offset, current + 1));
-    }
-  }
-  return sum;
+template <class T>
+std::vector<T> TableMixedStrategyProfileRep<T>::Contract(const Array<std::vector<T>> &p_probs,
+                                                         const T *p_table, long p_blocks,
+                                                         int p_keep1, int p_keep2) const
+{
+  return ContractTables(
+      p_probs, p_table, p_blocks, p_keep1, p_keep2,
+      dynamic_cast<GameTableRep &>(*this->m_support.GetGame()).GetWorkerPool());
 }
 
 template <class T> T TableMixedStrategyProfileRep<T>::GetPayoff(int pl) const
 {
-  return GetPayoff(pl, 1, 1);
+  return Contract(GetTableProbs(), GetPayoffTable(pl), 1).front();
+}
+
+template <class T> Vector<T> TableMixedStrategyProfileRep<T>::GetPayoffs() const
+{
+  // The tables for all players are stored consecutively, so they can be
+  // contracted together in a single sweep
+  auto payoffs =
+      Contract(GetTableProbs(), GetPayoffTable(1), this->m_support.GetGame()->NumPlayers());
+  Vector<T> ret(payoffs.size());
+  for (size_t pl = 1; pl <= payoffs.size(); pl++) {
+    ret[pl] = payoffs[pl - 1];
+  }
+  return ret;
+}
+
+template <class T> PVector<T> TableMixedStrategyProfileRep<T>::GetStrategyValues() const
+{
+  Game game = this->m_support.GetGame();
+  auto values = TableStrategyValues(GetTableProbs(), GetPayoffTable(1),
+                                    dynamic_cast<GameTableRep &>(*game).GetWorkerPool());
+  PVector<T> ret(game->NumStrategies());
+  auto value = values.cbegin();
+  for (auto player : game->GetPlayers()) {
+    for (int st = 1; st <= player->NumStrategies(); st++) {
+      ret(player->GetNumber(), st) = *value++;
+    }
+  }
+  return ret;
 }
 
 template <class T>
-void TableMixedStrategyProfileRep<T>::GetPayoffDeriv(int pl, int const_pl, int cur_pl, long index,
-                                                     const T &prob, T &value) const
+void TableMixedStrategyProfileRep<T>::GetPayoffDeriv(const T *p_payoffs, int const_pl, int cur_pl,
+                                                     long index, const T &prob, T &value) const
 {
   if (cur_pl == const_pl) {
     cur_pl++;
   }
   if (cur_pl > this->m_support.GetGame()->NumPlayers()) {
-    Game game = this->m_support.GetGame();
-    auto &g = dynamic_cast<GameTableRep &>(*game);
-    GameOutcomeRep *outcome = g.m_results[index];
-    if (outcome) {
-      value += prob * static_cast<T>(outcome->GetPayoff(pl));
-    }
+    value += prob * p_payoffs[index];
   }
   else {
     for (auto s : this->m_support.GetStrategies(this->m_support.GetGame()->GetPlayer(cur_pl))) {
       if ((*this)[s] > T(0)) {
-        GetPayoffDeriv(pl, const_pl, cur_pl + 1, index + s->m_offset, prob * (*this)[s], value);
+        GetPayoffDeriv(p_payoffs, const_pl, cur_pl + 1, index + s->m_offset, prob * (*this)[s],
+                       value);
       }
     }
   }
@@ -211,30 +575,26 @@ template <class T>
 T TableMixedStrategyProfileRep<T>::GetPayoffDeriv(int pl, const GameStrategy &strategy) const
 {
   T value = T(0);
-  GetPayoffDeriv(pl, strategy->GetPlayer()->GetNumber(), 1, strategy->m_offset + 1, T(1), value);
+  GetPayoffDeriv(GetPayoffTable(pl), strategy->GetPlayer()->GetNumber(), 1, strategy->m_offset,
+                 T(1), value);
   return value;
 }
 
 template <class T>
-void TableMixedStrategyProfileRep<T>::GetPayoffDeriv(int pl, int const_pl1, int const_pl2,
-                                                     int cur_pl, long index, const T &prob,
-                                                     T &value) const
+void TableMixedStrategyProfileRep<T>::GetPayoffDeriv(const T *p_payoffs, int const_pl1,
+                                                     int const_pl2, int cur_pl, long index,
+                                                     const T &prob, T &value) const
 {
   while (cur_pl == const_pl1 || cur_pl == const_pl2) {
     cur_pl++;
   }
   if (cur_pl > this->m_support.GetGame()->NumPlayers()) {
-    Game game = this->m_support.GetGame();
-    auto &g = dynamic_cast<GameTableRep &>(*game);
-    GameOutcomeRep *outcome = g.m_results[index];
-    if (outcome) {
-      value += prob * static_cast<T>(outcome->GetPayoff(pl));
-    }
+    value += prob * p_payoffs[index];
   }
   else {
     for (auto s : this->m_support.GetStrategies(this->m_support.GetGame()->GetPlayer(cur_pl))) {
       if ((*this)[s] > static_cast<T>(0)) {
-        GetPayoffDeriv(pl, const_pl1, const_pl2, cur_pl + 1, index + s->m_offset,
+        GetPayoffDeriv(p_payoffs, const_pl1, const_pl2, cur_pl + 1, index + s->m_offset,
                        prob * (*this)[s], value);
       }
     }
@@ -252,11 +612,73 @@ T TableMixedStrategyProfileRep<T>::GetPayoffDeriv(int pl, const GameStrategy &st
   }
 
   T value = T(0);
-  GetPayoffDeriv(pl, player1->GetNumber(), player2->GetNumber(), 1,
-                 strategy1->m_offset + strategy2->m_offset + 1, T(1), value);
+  GetPayoffDeriv(GetPayoffTable(pl), player1->GetNumber(), player2->GetNumber(), 1,
+                 strategy1->m_offset + strategy2->m_offset, T(1), value);
   return value;
 }
 
+template <class T> Matrix<T> TableMixedStrategyProfileRep<T>::GetStrategyValueDerivs() const
+{
+  // Strategy ids number the strategies by player and then in table order
+  Game game = this->m_support.GetGame();
+  Matrix<T> derivs(game->MixedProfileLength(), game->MixedProfileLength());
+  TableStrategyValueDerivs(GetTableProbs(), GetPayoffTable(1),
+                           dynamic_cast<GameTableRep &>(*game).GetWorkerPool(), derivs);
+  return derivs;
+}
+
+template <class T>
+PVector<T> TableMixedStrategyProfileRep<T>::GetStrategyValueChanges(int p_player,
+                                                                   const Vector<T> &p_delta) const
+{
+  Game game = this->m_support.GetGame();
+  auto probs = GetTableProbs();
+  PVector<T> changes(game->NumStrategies());
+  changes = static_cast<T>(0);
+
+  // Contract p_player's axis of the stacked tables first, visiting only the
+  // slices for strategies whose probability changes
+  long inner = 1, outer = game->NumPlayers();
+  for (int pl = 1; pl <= game->NumPlayers(); pl++) {
+    if (pl < p_player) {
+      inner *= probs[pl].size();
+    }
+    else if (pl > p_player) {
+      outer *= probs[pl].size();
+    }
+  }
+  const int dim = probs[p_player].size();
+  const T *table = GetPayoffTable(1);
+  std::vector<T> reduced(inner * outer, static_cast<T>(0));
+  for (int st = 0; st < dim; st++) {
+    const T &delta = p_delta[st + 1];
+    if (delta == static_cast<T>(0)) {
+      continue;
+    }
+    for (long b = 0; b < outer; b++) {
+      const T *slice = table + (b * dim + st) * inner;
+      T *result = reduced.data() + b * inner;
+      for (long a = 0; a < inner; a++) {
+        result[a] += delta * slice[a];
+      }
+    }
+  }
+
+  // The reduced tables have a single entry along p_player's axis
+  probs[p_player].assign(1, static_cast<T>(1));
+  const long size = inner * outer / game->NumPlayers();
+  for (int pl = 1; pl <= game->NumPlayers(); pl++) {
+    if (pl == p_player) {
+      continue;
+    }
+    auto player_changes = Contract(probs, reduced.data() + (pl - 1) * size, 1, pl);
+    for (size_t st = 1; st <= player_changes.size(); st++) {
+      changes(pl, st) = player_changes[st - 1];
+    }
+  }
+  return changes;
+}
+
 template class TableMixedStrategyProfileRep<double>;
 template class TableMixedStrategyProfileRep<Rational>;
 
@@ -303,6 +725,8 @@ GameTableRep::GameTableRep(const Array<int> &dim, bool p_sparseOutcomes /* = fal
   }
 }
 
+GameTableRep::~GameTableRep() = default;
+
 Game GameTableRep::Copy() const
 {
   std::ostringstream os;
@@ -339,6 +763,116 @@ bool GameTableRep::IsConstSum() const
   return true;
 }
 
+//------------------------------------------------------------------------
+//                   GameTableRep: Dense payoff access
+//------------------------------------------------------------------------
+
+namespace {
+
+/// Fill p_table with the payoffs to each player in each contingency,
+/// one contiguous block of contingencies per player.
+template <class T>
+void BuildPayoffTable(const Array<GameOutcomeRep *> &p_results, int p_numPlayers,
+                      std::vector<T> &p_table)
+{
+  long ncont = p_results.Length();
+  p_table.assign(p_numPlayers * ncont, T(0));
+  for (long cont = 1; cont <= ncont; cont++) {
+    if (GameOutcomeRep *outcome = p_results[cont]) {
+      for (int pl = 1; pl <= p_numPlayers; pl++) {
+        p_table[(pl - 1) * ncont + cont - 1] = static_cast<const T &>(outcome->GetPayoff(pl));
+      }
+    }
+  }
+}
+
+} // end anonymous namespace
+
+template <> const double *GameTableRep::GetPayoffTable<double>(int pl) const
+{
+  if (!m_doublePayoffsValid || m_doublePayoffsVersion != m_version) {
+    BuildPayoffTable(m_results, NumPlayers(), m_doublePayoffs);
+    m_doublePayoffsValid = true;
+    m_doublePayoffsVersion = m_version;
+  }
+  return m_doublePayoffs.data() + (pl - 1) * m_results.Length();
+}
+
+template <> const Rational *GameTableRep::GetPayoffTable<Rational>(int pl) const
+{
+  if (!m_rationalPayoffsValid || m_rationalPayoffsVersion != m_version) {
+    BuildPayoffTable(m_results, NumPlayers(), m_rationalPayoffs);
+    m_rationalPayoffsValid = true;
+    m_rationalPayoffsVersion = m_version;
+  }
+  return m_rationalPayoffs.data() + (pl - 1) * m_results.Length();
+}
+
+std::vector<int> GameTableRep::GetPayoffRanks() const
+{
+  const long ncont = m_results.Length();
+  std::vector<int> ranks(NumPlayers() * ncont);
+  // Contingencies with no outcome pay zero
+  const Rational zero(0);
+  for (int pl = 1; pl <= NumPlayers(); pl++) {
+    // Each distinct payoff is held once by the game, so the values can be
+    // collected by address, and then sorted once each
+    std::vector<const Rational *> values = {&zero};
+    for (auto outcome : m_outcomes) {
+      values.push_back(&static_cast<const Rational &>(outcome->GetPayoff(pl)));
+    }
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+    std::sort(values.begin(), values.end(),
+              [](const Rational *p_a, const Rational *p_b) { return *p_a < *p_b; });
+    std::unordered_map<const Rational *, int> rank;
+    for (size_t i = 0, r = 0; i < values.size(); i++) {
+      // Values with different representations, such as 0.5 and 1/2, share a rank
+      if (i > 0 && *values[i - 1] < *values[i]) {
+        r++;
+      }
+      rank[values[i]] = static_cast<int>(r);
+    }
+    int *table = ranks.data() + (pl - 1) * ncont;
+    for (long cont = 1; cont <= ncont; cont++) {
+      const GameOutcomeRep *outcome = m_results[cont];
+      table[cont - 1] =
+          rank[(outcome) ? &static_cast<const Rational &>(outcome->GetPayoff(pl)) : &zero];
+    }
+  }
+  return ranks;
+}
+
+void GameTableRep::SetNumThreads(int p_threads)
+{
+  if (p_threads < 0) {
+    throw ValueException("The number of threads must be non-negative");
+  }
+  m_numThreads = (p_threads > 0)
+                     ? p_threads
+                     : static_cast<int>(std::max(1U, std::thread::hardware_concurrency()));
+  m_pool.reset((m_numThreads > 1) ? new WorkerPool(m_numThreads) : nullptr);
+}
+
+void GameTableRep::UpdatePayoffTables(long p_index) const
+{
+  // Tables built for an earlier version will be rebuilt in full on next access
+  bool updateDouble = m_doublePayoffsValid && m_doublePayoffsVersion == m_version;
+  bool updateRational = m_rationalPayoffsValid && m_rationalPayoffsVersion == m_version;
+  long ncont = m_results.Length();
+  GameOutcomeRep *outcome = m_results[p_index];
+  for (int pl = 1; pl <= NumPlayers(); pl++) {
+    long cell = (pl - 1) * ncont + p_index - 1;
+    if (updateDouble) {
+      m_doublePayoffs[cell] = (outcome) ? static_cast<double>(outcome->GetPayoff(pl)) : 0.0;
+    }
+    if (updateRational) {
+      m_rationalPayoffs[cell] =
+          (outcome) ? static_cast<const Rational &>(outcome->GetPayoff(pl)) : Rational(0);
+    }
+  }
+}
+
 //------------------------------------------------------------------------
 //                   GameTableRep: Writing data files
 //------------------------------------------------------------------------
@@ -403,7 +937,7 @@ void GameTableRep::WriteNfgFile(std::ostream &p_file) const
   for (auto outcome : m_outcomes) {
     p_file << "{ \"" << EscapeQuotes(outcome->m_label) << "\" ";
     for (int pl = 1; pl <= m_players.Length(); pl++) {
-      p_file << (const std::string &)outcome->m_payoffs[pl];
+      p_file << (const std::string &)*outcome->m_payoffs[pl];
       if (pl < m_players.Length()) {
         p_file << ", ";
       }
@@ -436,7 +970,7 @@ GamePlayer GameTableRep::NewPlayer()
   auto player = new GamePlayerRep(this, m_players.size() + 1, 1);
   m_players.push_back(player);
   for (auto outcome : m_outcomes) {
-    outcome->m_payoffs.push_back(Number());
+    outcome->m_payoffs.push_back(m_numbers.Zero());
   }
   return player;
 }
@@ -453,7 +987,11 @@ void GameTableRep::DeleteOutcome(const GameOutcome &p_outcome)
       m_results[i] = 0;
     }
   }
-  m_outcomes.Remove(m_outcomes.Find(p_outcome))->Invalidate();
+  GameOutcomeRep *outcome = m_outcomes.Remove(m_outcomes.Find(p_outcome));
+  for (auto payoff : outcome->m_payoffs) {
+    m_numbers.Release(payoff);
+  }
+  outcome->Invalidate();
   for (int outc = 1; outc <= m_outcomes.Length(); outc++) {
     m_outcomes[outc]->m_number = outc;
   }
@@ -551,4 +1089,169 @@ void GameTableRep::IndexStrategies()
   }
 }
 
+//========================================================================
+//                        class BestResponseIndex
+//========================================================================
+
+BestResponseIndex::BestResponseIndex(const Game &p_game)
+  : m_game(p_game), m_numContingencies(0)
+{
+  const auto *table = dynamic_cast<const GameTableRep *>(p_game.operator->());
+  if (!table) {
+    throw UndefinedException("Best response index is only defined for strategic games");
+  }
+  m_numContingencies = table->NumContingencies();
+  for (int pl = 1; pl <= table->NumPlayers(); pl++) {
+    m_dims.push_back(table->GetPlayer(pl)->NumStrategies());
+    m_strides.push_back((pl == 1) ? 1 : m_strides.back() * m_dims[pl - 2]);
+  }
+  // Comparisons are done on the ranks of payoffs, rather than the payoffs themselves
+  m_ranks = table->GetPayoffRanks();
+}
+
+void BestResponseIndex::Build(int p_threads)
+{
+  const long threads =
+      std::min(static_cast<long>(p_threads), m_numContingencies / MinEntriesPerThread);
+  WorkerPool pool(static_cast<int>(threads));
+  m_bitmaps.clear();
+  // For each slice of the table along a player's strategies, the largest payoff rank
+  std::vector<int> best;
+  for (int pl = 1; pl <= static_cast<int>(m_dims.size()); pl++) {
+    const int *payoffs = GetRanks(pl);
+    const long inner = m_strides[pl - 1];
+    const int dim = m_dims[pl - 1];
+
+    // Slice (b, a) consists of the entries b * dim * inner + s * inner + a over the
+    // strategies s.  Numbering slices b * inner + a allows a range of slices with
+    // the same b to be scanned one row of strategies at a time.
+    best.resize(m_numContingencies / dim);
+    pool.ParallelFor(static_cast<long>(best.size()), threads, [&](long p_first, long p_last) {
+      for (long slice = p_first; slice < p_last;) {
+        const long a0 = slice % inner;
+        const long count = std::min(inner - a0, p_last - slice);
+        const int *block = payoffs + (slice / inner) * dim * inner + a0;
+        int *maxima = &best[slice];
+        std::copy(block, block + count, maxima);
+        for (int s = 1; s < dim; s++) {
+          const int *row = block + s * inner;
+          for (long a = 0; a < count; a++) {
+            maxima[a] = std::max(maxima[a], row[a]);
+          }
+        }
+        slice += count;
+      }
+    });
+
+    m_bitmaps.emplace_back(NumWords(), 0);
+    Word *bitmap = m_bitmaps.back().data();
+    pool.ParallelFor(NumWords(), threads, [&](long p_first, long p_last) {
+      for (long w = p_first; w < p_last; w++) {
+        const long end = std::min(static_cast<long>(WordBits), m_numContingencies - w * WordBits);
+        Word bits = 0;
+        for (long k = 0, index = w * WordBits; k < end; k++, index++) {
+          if (payoffs[index] == best[index / (dim * inner) * inner + index % inner]) {
+            bits |= Word(1) << k;
+          }
+        }
+        bitmap[w] = bits;
+      }
+    });
+  }
+}
+
+void BestResponseIndex::GetNashEquilibria(long p_begin, long p_end, Word *p_result) const
+{
+  std::copy(m_bitmaps.front().begin() + p_begin, m_bitmaps.front().begin() + p_end, p_result);
+  for (size_t pl = 1; pl < m_bitmaps.size(); pl++) {
+    const Word *bitmap = m_bitmaps[pl].data();
+    for (long w = p_begin; w < p_end; w++) {
+      p_result[w - p_begin] &= bitmap[w];
+    }
+  }
+}
+
+bool BestResponseIndex::CheckBestResponse(int pl, long p_index) const
+{
+  const int *payoffs = GetRanks(pl);
+  const long stride = m_strides[pl - 1];
+  const int current = payoffs[p_index];
+  const int *deviation = payoffs + p_index - (GetStrategyNumber(pl, p_index) - 1) * stride;
+  for (int st = 0; st < m_dims[pl - 1]; st++, deviation += stride) {
+    if (*deviation > current) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void BestResponseIndex::FindNashEquilibria(long p_begin, long p_end,
+                                           std::vector<long> &p_found) const
+{
+  const int size = m_dims.front();
+  for (long slice = p_begin; slice < p_end; slice++) {
+    const long base = slice * size;
+    const int *payoffs = GetRanks(1) + base;
+    const int best = *std::max_element(payoffs, payoffs + size);
+    for (int st = 0; st < size; st++) {
+      if (payoffs[st] != best) {
+        continue;
+      }
+      bool isNash = true;
+      for (int pl = 2; isNash && pl <= static_cast<int>(m_dims.size()); pl++) {
+        isNash = CheckBestResponse(pl, base + st);
+      }
+      if (isNash) {
+        p_found.push_back(base + st);
+      }
+    }
+  }
+}
+
+//========================================================================
+//                         class TablePayoffs
+//========================================================================
+
+TablePayoffs::TablePayoffs(const Game &p_game) : m_numContingencies(0)
+{
+  const auto *table = dynamic_cast<const GameTableRep *>(p_game.operator->());
+  if (!table) {
+    throw UndefinedException("Payoff tables are only defined for strategic games");
+  }
+  m_numContingencies = table->NumContingencies();
+  for (int pl = 1; pl <= table->NumPlayers(); pl++) {
+    m_offsets.push_back((pl == 1) ? 0 : m_offsets.back() + m_dims.back());
+    m_dims.push_back(table->GetPlayer(pl)->NumStrategies());
+  }
+  const double *payoffs = table->GetPayoffTable<double>(1);
+  m_payoffs.assign(payoffs, payoffs + table->NumPlayers() * m_numContingencies);
+}
+
+Array<std::vector<double>> TablePayoffs::GetTableProbs(const Vector<double> &p_probs) const
+{
+  Array<std::vector<double>> probs(NumPlayers());
+  for (int pl = 1; pl <= NumPlayers(); pl++) {
+    probs[pl].resize(m_dims[pl - 1]);
+    for (int st = 1; st <= m_dims[pl - 1]; st++) {
+      probs[pl][st - 1] = p_probs[m_offsets[pl - 1] + st];
+    }
+  }
+  return probs;
+}
+
+void TablePayoffs::GetStrategyValues(const Vector<double> &p_probs,
+                                     Vector<double> &p_values) const
+{
+  auto values = TableStrategyValues(GetTableProbs(p_probs), m_payoffs.data(), nullptr);
+  for (size_t i = 0; i < values.size(); i++) {
+    p_values[i + 1] = values[i];
+  }
+}
+
+void TablePayoffs::GetStrategyValueDerivs(const Vector<double> &p_probs,
+                                          Matrix<double> &p_derivs) const
+{
+  TableStrategyValueDerivs(GetTableProbs(p_probs), m_payoffs.data(), nullptr, p_derivs);
+}
+
 } // end namespace Gambit
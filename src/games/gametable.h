@@ -23,12 +23,18 @@
 #ifndef GAMETABLE_H
 #define GAMETABLE_H
 
+#include <cstdint>
+#include <memory>
+
 #include "gameexpl.h"
 
 namespace Gambit {
 
+class WorkerPool;
+
 class GameTableRep : public GameExplicitRep {
   friend class StrategySupportProfile;
+  friend class GameStrategyRep;
   friend class GamePlayerRep;
   friend class TablePureStrategyProfileRep;
   friend class PureStrategyProfileRep;
@@ -38,10 +44,30 @@ class GameTableRep : public GameExplicitRep {
 private:
   Array<GameOutcomeRep *> m_results;
 
+  /// @name Dense payoff tables
+  ///
+  /// For each player, the payoffs in every contingency, stored contiguously
+  /// and indexed by the sum of the strategy offsets in the contingency
+  /// (i.e., one less than the index into m_results).  The tables for
+  /// player pl occupy the block beginning at (pl - 1) * (number of contingencies).
+  /// These are built on demand, and rebuilt whenever the game version changes.
+  //@{
+  mutable std::vector<double> m_doublePayoffs;
+  mutable std::vector<Rational> m_rationalPayoffs;
+  mutable bool m_doublePayoffsValid{false}, m_rationalPayoffsValid{false};
+  mutable unsigned int m_doublePayoffsVersion{0}, m_rationalPayoffsVersion{0};
+  //@}
+  /// Number of threads used to evaluate mixed strategy profiles
+  int m_numThreads{1};
+  /// The threads other than the calling one, if more than one is used
+  std::unique_ptr<WorkerPool> m_pool;
+
   /// @name Private auxiliary functions
   //@{
   void IndexStrategies();
   void RebuildTable();
+  /// Update the dense payoff tables, if built, to reflect a new outcome at p_index
+  void UpdatePayoffTables(long p_index) const;
   //@}
 
 public:
@@ -50,6 +76,7 @@ public:
   /// Construct a new table game with the given dimension
   /// If p_sparseOutcomes = true, outcomes for all contingencies are left null
   explicit GameTableRep(const Array<int> &p_dim, bool p_sparseOutcomes = false);
+  ~GameTableRep() override;
   Game Copy() const override;
   //@}
 
@@ -104,6 +131,35 @@ public:
   void DeleteOutcome(const GameOutcome &) override;
   //@}
 
+  /// @name Dense payoff access
+  //@{
+  /// Returns the number of contingencies in the table
+  long NumContingencies() const { return m_results.Length(); }
+  /// Returns a pointer to the dense table of payoffs to player pl.
+  /// The payoff in a contingency is found at the sum of the offsets of the
+  /// strategies in the contingency.  The pointer is invalidated by any
+  /// subsequent change to the game.
+  template <class T> const T *GetPayoffTable(int pl) const;
+  /// Returns the ranks of the payoffs in the dense tables.  Each payoff is replaced
+  /// by its position, counting from zero, among the distinct values of the player's
+  /// payoffs, so that payoffs to a player compare as their ranks do.  The ranks for
+  /// all players are laid out as the dense tables are.  Comparing the ranks needs no
+  /// exact arithmetic, so several threads may do it at once.
+  std::vector<int> GetPayoffRanks() const;
+  /// Returns the number of threads used to evaluate mixed strategy profiles
+  int NumThreads() const { return m_numThreads; }
+  /// Sets the number of threads used to evaluate mixed strategy profiles.
+  /// Large tables are divided among the threads when computing in floating point;
+  /// small ones, and all exact computations, are evaluated serially.  The results
+  /// do not depend on the number of threads.  The threads are started here, and
+  /// kept until the number is changed or the game is destroyed.
+  /// If p_threads is zero, one thread per hardware thread is used.
+  void SetNumThreads(int p_threads);
+  /// Returns the threads used to evaluate mixed strategy profiles, or null if only
+  /// the calling thread is used
+  WorkerPool *GetWorkerPool() const { return m_pool.get(); }
+  //@}
+
   /// @name Writing data files
   //@{
   /// Write the game to a file in .nfg outcome format
@@ -126,6 +182,135 @@ public:
   NewMixedStrategyProfile(const Rational &, const StrategySupportProfile &) const override;
 };
 
+template <> const double *GameTableRep::GetPayoffTable<double>(int pl) const;
+template <> const Rational *GameTableRep::GetPayoffTable<Rational>(int pl) const;
+
+///
+/// An index of the pure best responses in a table game.  For each player,
+/// a bitmap records the contingencies in which the player's strategy is a
+/// best response to the strategies of the other players.  Contingencies are
+/// numbered as in the dense payoff tables, from zero, with bit k of word w of
+/// a bitmap corresponding to contingency WordBits * w + k.
+///
+/// The index holds the ranks of the payoffs at the time it is constructed,
+/// and is not updated if the game changes.  The bitmaps are built only when
+/// requested.  The pure-strategy equilibria in a range of slices along the
+/// first player's strategies can instead be found directly, checking the
+/// other players only where the first player is playing a best response.
+/// Once constructed, the index refers to no game objects except in GetGame(),
+/// so several threads may search different ranges at once.
+///
+class BestResponseIndex {
+public:
+  using Word = std::uint64_t;
+  static constexpr int WordBits = 64;
+
+  /// @name Lifecycle
+  //@{
+  /// Prepare the index for the table game, without building the bitmaps
+  explicit BestResponseIndex(const Game &p_game);
+  /// Build the bitmaps, dividing the work among up to p_threads threads
+  void Build(int p_threads = 1);
+  //@}
+
+  /// @name Data access
+  //@{
+  /// Returns the game on which the index is defined
+  const Game &GetGame() const { return m_game; }
+  /// Returns the number of contingencies in the game
+  long NumContingencies() const { return m_numContingencies; }
+  /// Returns the number of slices along the first player's strategies
+  long NumSlices() const { return m_numContingencies / m_dims.front(); }
+  /// Returns the number of words in each bitmap
+  long NumWords() const { return (m_numContingencies + WordBits - 1) / WordBits; }
+  /// Returns the number of player pl's strategy in the contingency
+  int GetStrategyNumber(int pl, long p_index) const
+  {
+    return static_cast<int>(p_index / m_strides[pl - 1] % m_dims[pl - 1]) + 1;
+  }
+  //@}
+
+  /// @name Querying the bitmaps
+  /// These may only be called once Build() has been called.
+  //@{
+  /// Returns the bitmap of contingencies in which player pl plays a best response.
+  /// Bits beyond the last contingency are zero.
+  const Word *GetBestResponses(int pl) const { return m_bitmaps[pl - 1].data(); }
+  /// Is player pl's strategy a best response in the contingency?
+  bool IsBestResponse(int pl, long p_index) const
+  {
+    return (m_bitmaps[pl - 1][p_index / WordBits] >> (p_index % WordBits)) & 1;
+  }
+  /// Writes to p_result the intersection of the players' bitmaps over the words
+  /// [p_begin, p_end), that is, the pure-strategy Nash equilibria.
+  void GetNashEquilibria(long p_begin, long p_end, Word *p_result) const;
+  //@}
+
+  /// @name Searching for equilibria
+  //@{
+  /// Appends to p_found, in increasing order, the contingencies in the slices
+  /// [p_begin, p_end) along the first player's strategies in which every player
+  /// plays a best response.  The first player's best responses are found once
+  /// per slice, and the other players are checked only at those.  This does not
+  /// use the bitmaps.
+  void FindNashEquilibria(long p_begin, long p_end, std::vector<long> &p_found) const;
+  //@}
+
+private:
+  Game m_game;
+  long m_numContingencies;
+  std::vector<int> m_dims;
+  std::vector<long> m_strides;
+  std::vector<int> m_ranks;
+  std::vector<std::vector<Word>> m_bitmaps;
+
+  /// Returns the dense table of ranks of player pl's payoffs
+  const int *GetRanks(int pl) const { return m_ranks.data() + (pl - 1) * m_numContingencies; }
+  /// Is player pl's strategy a best response in the contingency, checked against
+  /// each of the player's other strategies?
+  bool CheckBestResponse(int pl, long p_index) const;
+};
+
+/// A copy of the payoffs of a table game, for computing strategy values of
+/// mixed strategy profiles given as vectors of probabilities, indexed as in
+/// MixedStrategyProfile.  Once constructed it refers to no game objects, and
+/// so it may be used from several threads at once.
+class TablePayoffs {
+public:
+  /// @name Lifecycle
+  //@{
+  /// Copy the payoffs of the table game
+  explicit TablePayoffs(const Game &p_game);
+  //@}
+
+  /// @name Data access
+  //@{
+  /// Returns the number of players in the game
+  int NumPlayers() const { return static_cast<int>(m_dims.size()); }
+  /// Returns the number of strategies of player pl
+  int NumStrategies(int pl) const { return m_dims[pl - 1]; }
+  /// Returns the length of a mixed strategy profile on the game
+  int MixedProfileLength() const { return m_offsets.back() + m_dims.back(); }
+  //@}
+
+  /// @name Computation of values
+  //@{
+  /// Computes the value of each strategy against the profile p_probs
+  void GetStrategyValues(const Vector<double> &p_probs, Vector<double> &p_values) const;
+  /// Computes the derivative of the value of each strategy with respect to
+  /// the probability of each strategy, as MixedStrategyProfile::GetStrategyValueDerivs()
+  void GetStrategyValueDerivs(const Vector<double> &p_probs, Matrix<double> &p_derivs) const;
+  //@}
+
+private:
+  long m_numContingencies;
+  std::vector<int> m_dims, m_offsets;
+  std::vector<double> m_payoffs;
+
+  /// Returns the probabilities in p_probs of each player's strategies
+  Array<std::vector<double>> GetTableProbs(const Vector<double> &p_probs) const;
+};
+
 } // namespace Gambit
 
 #endif // GAMETABLE_H
@@ -22,7 +22,9 @@
 
 #include <iostream>
 #include <algorithm>
+#include <map>
 #include <numeric>
+#include <tuple>
 
 #include "gambit.h"
 #include "gametree.h"
@@ -46,56 +48,301 @@ TreeMixedStrategyProfileRep<T>::TreeMixedStrategyProfileRep(
 
 template <class T> MixedStrategyProfileRep<T> *TreeMixedStrategyProfileRep<T>::Copy() const
 {
-  return new TreeMixedStrategyProfileRep(*this);
+  // The sequence structure is shared, but the weights are recomputed on demand, as
+  // the copy's probabilities may be changed without invalidating its cache
+  auto *copy = new TreeMixedStrategyProfileRep(*this);
+  copy->m_sequenceWeights.clear();
+  return copy;
+}
+
+/// The sequences of each player, and the payoffs accrued in the tree, grouped by
+/// the combination of the players' last sequences at the nodes where they accrue
+template <class T> class TreeMixedStrategyProfileRep<T>::Sequences {
+public:
+  int m_numPlayers{0};
+  /// For each player, the number of the first sequence at each information set,
+  /// less one.  Sequence 0 is the empty sequence.
+  std::vector<std::vector<int>> m_infosetOffsets;
+  /// The number of sequences of each player, including the empty sequence
+  std::vector<int> m_numSequences;
+  /// For each strategy, indexed by id less one, the sequences consistent with it
+  std::vector<std::vector<int>> m_strategySequences;
+  /// For each record, each player's last sequence; m_numPlayers entries per record
+  std::vector<int> m_records;
+  /// For each record, the payoff to each player, weighted by the probability of
+  /// chance moves; m_numPlayers entries per record
+  std::vector<T> m_payoffs;
+
+  size_t NumRecords() const { return m_payoffs.size() / m_numPlayers; }
+};
+
+template <class T>
+const typename TreeMixedStrategyProfileRep<T>::Sequences &
+TreeMixedStrategyProfileRep<T>::GetSequences() const
+{
+  if (m_sequences) {
+    return *m_sequences;
+  }
+  Game game = this->m_support.GetGame();
+  auto sequences = std::make_shared<Sequences>();
+  sequences->m_numPlayers = game->NumPlayers();
+  for (auto player : game->GetPlayers()) {
+    std::vector<int> offsets;
+    int count = 1;
+    for (auto infoset : player->GetInfosets()) {
+      offsets.push_back(count - 1);
+      count += infoset->NumActions();
+    }
+    sequences->m_infosetOffsets.push_back(offsets);
+    sequences->m_numSequences.push_back(count);
+  }
+
+  auto strategies = game->GetStrategies();
+  sequences->m_strategySequences.resize(strategies.size());
+  for (auto strategy : strategies) {
+    const auto &offsets = sequences->m_infosetOffsets[strategy->GetPlayer()->GetNumber() - 1];
+    auto &consistent = sequences->m_strategySequences[strategy->GetId() - 1];
+    consistent.push_back(0);
+    for (int iset = 1; iset <= strategy->m_behav.Length(); iset++) {
+      // Reduced strategies specify actions exactly at the information sets they reach
+      if (strategy->m_behav[iset] > 0) {
+        consistent.push_back(offsets[iset - 1] + strategy->m_behav[iset]);
+      }
+    }
+  }
+
+  // Sweep the nodes in preorder, carrying down the probability of chance moves
+  // and each player's last sequence; nodes reached with probability zero are skipped.
+  const CompiledGameTree &tree = dynamic_cast<GameTreeRep &>(*game).GetCompiledTree();
+  const int numPlayers = sequences->m_numPlayers;
+  std::vector<T> probs(tree.NumNodes(), T(0));
+  std::vector<int> current(tree.NumNodes() * numPlayers, 0);
+  std::map<std::vector<int>, size_t> index;
+  probs[0] = T(1);
+  for (int node = 0; node < tree.NumNodes(); node++) {
+    if (probs[node] == T(0)) {
+      continue;
+    }
+    const int *last = &current[node * numPlayers];
+    if (tree.m_outcomes[node]) {
+      auto entry =
+          index.emplace(std::vector<int>(last, last + numPlayers), sequences->NumRecords());
+      if (entry.second) {
+        sequences->m_records.insert(sequences->m_records.end(), last, last + numPlayers);
+        sequences->m_payoffs.resize(sequences->m_payoffs.size() + numPlayers, T(0));
+      }
+      T *payoffs = &sequences->m_payoffs[entry.first->second * numPlayers];
+      for (int pl = 1; pl <= numPlayers; pl++) {
+        payoffs[pl - 1] += probs[node] * tree.GetPayoff<T>(node, pl);
+      }
+    }
+    const int pl = tree.m_players[node];
+    for (int k = tree.m_childStart[node], act = 1; k < tree.m_childStart[node + 1];
+         k++, act++) {
+      const int child = tree.m_children[k];
+      std::copy_n(last, numPlayers, &current[child * numPlayers]);
+      if (pl == 0) {
+        probs[child] = probs[node] * tree.GetChanceProb<T>(node, act);
+      }
+      else {
+        probs[child] = probs[node];
+        current[child * numPlayers + pl - 1] =
+            sequences->m_infosetOffsets[pl - 1][tree.m_infosets[node]->m_number - 1] + act;
+      }
+    }
+  }
+  m_sequences = sequences;
+  return *m_sequences;
+}
+
+template <class T> void TreeMixedStrategyProfileRep<T>::ComputeSequenceWeights() const
+{
+  if (!m_sequenceWeights.empty()) {
+    return;
+  }
+  const Sequences &sequences = GetSequences();
+  m_sequenceWeights.resize(sequences.m_numPlayers);
+  for (auto player : this->m_support.GetGame()->GetPlayers()) {
+    auto &weights = m_sequenceWeights[player->GetNumber() - 1];
+    weights.assign(sequences.m_numSequences[player->GetNumber() - 1], T(0));
+    for (auto strategy : this->m_support.GetStrategies(player)) {
+      const T &prob = (*this)[strategy];
+      for (auto seq : sequences.m_strategySequences[strategy->GetId() - 1]) {
+        weights[seq] += prob;
+      }
+    }
+  }
+}
+
+template <class T>
+T TreeMixedStrategyProfileRep<T>::GetOtherWeights(const int *p_sequences, int p_skip1,
+                                                  int p_skip2) const
+{
+  T weight(1);
+  for (size_t pl = 1; pl <= m_sequenceWeights.size(); pl++) {
+    if (static_cast<int>(pl) != p_skip1 && static_cast<int>(pl) != p_skip2) {
+      weight *= m_sequenceWeights[pl - 1][p_sequences[pl - 1]];
+    }
+  }
+  return weight;
 }
 
 template <class T> T TreeMixedStrategyProfileRep<T>::GetPayoff(int pl) const
 {
-  if (mixed_behav_profile_sptr.get() == nullptr) {
-    MixedStrategyProfile<T> tmp(Copy());
-    mixed_behav_profile_sptr = std::make_shared<MixedBehaviorProfile<T>>(tmp);
+  ComputeSequenceWeights();
+  const Sequences &sequences = GetSequences();
+  const int numPlayers = sequences.m_numPlayers;
+  T payoff(0);
+  for (size_t r = 0; r < sequences.NumRecords(); r++) {
+    payoff += sequences.m_payoffs[r * numPlayers + pl - 1] *
+              GetOtherWeights(&sequences.m_records[r * numPlayers], 0);
   }
-  return mixed_behav_profile_sptr->GetPayoff(pl);
+  return payoff;
 }
 
-template <class T> void TreeMixedStrategyProfileRep<T>::InvalidateCache() const
+template <class T> Vector<T> TreeMixedStrategyProfileRep<T>::GetPayoffs() const
 {
-  mixed_behav_profile_sptr = nullptr;
+  ComputeSequenceWeights();
+  const Sequences &sequences = GetSequences();
+  const int numPlayers = sequences.m_numPlayers;
+  Vector<T> payoffs(numPlayers);
+  payoffs = T(0);
+  for (size_t r = 0; r < sequences.NumRecords(); r++) {
+    const T weight = GetOtherWeights(&sequences.m_records[r * numPlayers], 0);
+    for (int pl = 1; pl <= numPlayers; pl++) {
+      payoffs[pl] += sequences.m_payoffs[r * numPlayers + pl - 1] * weight;
+    }
+  }
+  return payoffs;
+}
+
+template <class T> PVector<T> TreeMixedStrategyProfileRep<T>::GetStrategyValues() const
+{
+  ComputeSequenceWeights();
+  const Sequences &sequences = GetSequences();
+  const int numPlayers = sequences.m_numPlayers;
+  Game game = this->m_support.GetGame();
+  PVector<T> values(game->NumStrategies());
+  for (auto player : game->GetPlayers()) {
+    // The payoff accrued when each of the player's sequences is played
+    const int pl = player->GetNumber();
+    std::vector<T> accrued(sequences.m_numSequences[pl - 1], T(0));
+    for (size_t r = 0; r < sequences.NumRecords(); r++) {
+      const int *record = &sequences.m_records[r * numPlayers];
+      accrued[record[pl - 1]] +=
+          sequences.m_payoffs[r * numPlayers + pl - 1] * GetOtherWeights(record, pl);
+    }
+    for (auto strategy : player->GetStrategies()) {
+      T value(0);
+      for (auto seq : sequences.m_strategySequences[strategy->GetId() - 1]) {
+        value += accrued[seq];
+      }
+      values(pl, strategy->GetNumber()) = value;
+    }
+  }
+  return values;
 }
 
 template <class T>
 T TreeMixedStrategyProfileRep<T>::GetPayoffDeriv(int pl, const GameStrategy &strategy) const
 {
-  MixedStrategyProfile<T> foo(Copy());
-  for (auto s : this->m_support.GetStrategies(this->m_support.GetGame()->GetPlayer(pl))) {
-    foo[s] = static_cast<T>(0);
+  ComputeSequenceWeights();
+  const Sequences &sequences = GetSequences();
+  const int numPlayers = sequences.m_numPlayers;
+  const int player = strategy->GetPlayer()->GetNumber();
+  std::vector<bool> consistent(sequences.m_numSequences[player - 1], false);
+  for (auto seq : sequences.m_strategySequences[strategy->GetId() - 1]) {
+    consistent[seq] = true;
+  }
+  T value(0);
+  for (size_t r = 0; r < sequences.NumRecords(); r++) {
+    const int *record = &sequences.m_records[r * numPlayers];
+    if (consistent[record[player - 1]]) {
+      value += sequences.m_payoffs[r * numPlayers + pl - 1] * GetOtherWeights(record, player);
+    }
   }
-  foo[strategy] = static_cast<T>(1);
-  return foo.GetPayoff(pl);
+  return value;
 }
 
 template <class T>
 T TreeMixedStrategyProfileRep<T>::GetPayoffDeriv(int pl, const GameStrategy &strategy1,
                                                  const GameStrategy &strategy2) const
 {
-  GamePlayerRep *player1 = strategy1->GetPlayer();
-  GamePlayerRep *player2 = strategy2->GetPlayer();
+  const int player1 = strategy1->GetPlayer()->GetNumber();
+  const int player2 = strategy2->GetPlayer()->GetNumber();
   if (player1 == player2) {
     return T(0);
   }
 
-  MixedStrategyProfile<T> foo(Copy());
-  for (auto strategy : this->m_support.GetStrategies(player1)) {
-    foo[strategy] = T(0);
+  ComputeSequenceWeights();
+  const Sequences &sequences = GetSequences();
+  const int numPlayers = sequences.m_numPlayers;
+  std::vector<bool> consistent1(sequences.m_numSequences[player1 - 1], false);
+  for (auto seq : sequences.m_strategySequences[strategy1->GetId() - 1]) {
+    consistent1[seq] = true;
+  }
+  std::vector<bool> consistent2(sequences.m_numSequences[player2 - 1], false);
+  for (auto seq : sequences.m_strategySequences[strategy2->GetId() - 1]) {
+    consistent2[seq] = true;
+  }
+  T value(0);
+  for (size_t r = 0; r < sequences.NumRecords(); r++) {
+    const int *record = &sequences.m_records[r * numPlayers];
+    if (consistent1[record[player1 - 1]] && consistent2[record[player2 - 1]]) {
+      value += sequences.m_payoffs[r * numPlayers + pl - 1] *
+               GetOtherWeights(record, player1, player2);
+    }
   }
-  foo[strategy1] = T(1);
+  return value;
+}
 
-  for (auto strategy : this->m_support.GetStrategies(player2)) {
-    foo[strategy] = T(0);
+template <class T> Matrix<T> TreeMixedStrategyProfileRep<T>::GetStrategyValueDerivs() const
+{
+  ComputeSequenceWeights();
+  const Sequences &sequences = GetSequences();
+  const int numPlayers = sequences.m_numPlayers;
+  Game game = this->m_support.GetGame();
+  Matrix<T> derivs(game->GetStrategies().size(), game->GetStrategies().size());
+  derivs = T(0);
+  for (auto player1 : game->GetPlayers()) {
+    const int pl1 = player1->GetNumber();
+    for (auto player2 : game->GetPlayers()) {
+      const int pl2 = player2->GetNumber();
+      if (pl1 == pl2) {
+        continue;
+      }
+      // The payoff to player1 accrued when each pair of sequences of the two
+      // players is played, and then summed over the sequences of player1's strategies
+      const int numSequences2 = sequences.m_numSequences[pl2 - 1];
+      std::vector<T> accrued(sequences.m_numSequences[pl1 - 1] * numSequences2, T(0));
+      for (size_t r = 0; r < sequences.NumRecords(); r++) {
+        const int *record = &sequences.m_records[r * numPlayers];
+        accrued[record[pl1 - 1] * numSequences2 + record[pl2 - 1]] +=
+            sequences.m_payoffs[r * numPlayers + pl1 - 1] * GetOtherWeights(record, pl1, pl2);
+      }
+      std::vector<T> partial(numSequences2);
+      for (auto strategy1 : player1->GetStrategies()) {
+        std::fill(partial.begin(), partial.end(), T(0));
+        for (auto seq1 : sequences.m_strategySequences[strategy1->GetId() - 1]) {
+          for (int seq2 = 0; seq2 < numSequences2; seq2++) {
+            partial[seq2] += accrued[seq1 * numSequences2 + seq2];
+          }
+        }
+        for (auto strategy2 : player2->GetStrategies()) {
+          T &deriv = derivs(strategy1->GetId(), strategy2->GetId());
+          for (auto seq2 : sequences.m_strategySequences[strategy2->GetId() - 1]) {
+            deriv += partial[seq2];
+          }
+        }
+      }
+    }
   }
-  foo[strategy2] = T(1);
+  return derivs;
+}
 
-  return foo.GetPayoff(pl);
+template <class T> void TreeMixedStrategyProfileRep<T>::InvalidateCache() const
+{
+  m_sequenceWeights.clear();
 }
 
 template class TreeMixedStrategyProfileRep<double>;
@@ -407,6 +654,17 @@ void GameTreeNodeRep::SetOutcome(const GameOutcome &p_outcome)
 
 bool GameTreeNodeRep::IsSuccessorOf(GameNode p_node) const
 {
+  // If the compiled view of the tree is current, the subtree of p_node is an
+  // interval of the preorder
+  if (m_efg->m_compiledValid && m_efg->m_compiledVersion == m_efg->m_version) {
+    const CompiledGameTree &tree = m_efg->m_compiled;
+    const int index = tree.IndexOf(this);
+    const int from = tree.IndexOf(dynamic_cast<GameTreeNodeRep *>(p_node.operator->()));
+    if (index >= 0 && from >= 0) {
+      return from <= index && index < tree.m_subtreeEnd[from];
+    }
+  }
+
   auto *n = const_cast<GameTreeNodeRep *>(this);
   while (n && n != p_node) {
     n = n->m_parent;
@@ -424,22 +682,12 @@ bool GameTreeNodeRep::IsSubgameRoot() const
     return true;
   }
 
-  // A node is a subgame root if and only if in every information set,
-  // either all members succeed the node in the tree,
-  // or all members do not succeed the node in the tree.
-  for (auto player : m_efg->GetPlayers()) {
-    for (auto infoset : player->GetInfosets()) {
-      bool precedes = infoset->GetMember(1)->IsSuccessorOf(const_cast<GameTreeNodeRep *>(this));
-      for (int mem = 2; mem <= infoset->NumMembers(); mem++) {
-        if (infoset->GetMember(mem)->IsSuccessorOf(const_cast<GameTreeNodeRep *>(this)) !=
-            precedes) {
-          return false;
-        }
-      }
-    }
+  const CompiledGameTree &tree = m_efg->GetCompiledTree();
+  int index = tree.IndexOf(this);
+  if (index < 0) {
+    index = std::find(tree.m_nodes.begin(), tree.m_nodes.end(), this) - tree.m_nodes.begin();
   }
-
-  return true;
+  return tree.m_subgameRoots[index];
 }
 
 void GameTreeNodeRep::DeleteParent()
@@ -770,52 +1018,12 @@ bool GameTreeRep::IsConstSum() const
 
 bool GameTreeRep::IsPerfectRecall(GameInfoset &s1, GameInfoset &s2) const
 {
-  for (auto player : m_players) {
-    for (int i = 1; i <= player->NumInfosets(); i++) {
-      GameTreeInfosetRep *iset1 = player->m_infosets[i];
-      for (int j = 1; j <= player->NumInfosets(); j++) {
-        GameTreeInfosetRep *iset2 = player->m_infosets[j];
-
-        bool precedes = false;
-        int action = 0;
-
-        for (int m = 1; m <= iset2->NumMembers(); m++) {
-          int n;
-          for (n = 1; n <= iset1->NumMembers(); n++) {
-            if (iset2->GetMember(m)->IsSuccessorOf(iset1->GetMember(n)) &&
-                iset1->GetMember(n) != iset2->GetMember(m)) {
-              precedes = true;
-              for (int act = 1; act <= iset1->NumActions(); act++) {
-                if (iset2->GetMember(m)->IsSuccessorOf(iset1->GetMember(n)->GetChild(act))) {
-                  if (action != 0 && action != act) {
-                    s1 = iset1;
-                    s2 = iset2;
-                    return false;
-                  }
-                  action = act;
-                }
-              }
-              break;
-            }
-          }
-
-          if (i == j && precedes) {
-            s1 = iset1;
-            s2 = iset2;
-            return false;
-          }
-
-          if (n > iset1->NumMembers() && precedes) {
-            s1 = iset1;
-            s2 = iset2;
-            return false;
-          }
-        }
-      }
-    }
+  const CompiledGameTree &tree = GetCompiledTree();
+  if (!tree.m_perfectRecall) {
+    s1 = tree.m_recallInfoset1;
+    s2 = tree.m_recallInfoset2;
   }
-
-  return true;
+  return tree.m_perfectRecall;
 }
 
 //------------------------------------------------------------------------
@@ -824,9 +1032,15 @@ bool GameTreeRep::IsPerfectRecall(GameInfoset &s1, GameInfoset &s2) const
 
 void GameTreeRep::NumberNodes(GameTreeNodeRep *n, int &index)
 {
-  n->number = index++;
-  for (int child = 1; child <= n->children.Length(); NumberNodes(n->children[child++], index))
-    ;
+  std::vector<GameTreeNodeRep *> stack{n};
+  while (!stack.empty()) {
+    GameTreeNodeRep *node = stack.back();
+    stack.pop_back();
+    node->number = index++;
+    for (int child = node->children.Length(); child >= 1; child--) {
+      stack.push_back(node->children[child]);
+    }
+  }
 }
 
 void GameTreeRep::Canonicalize()
@@ -841,43 +1055,32 @@ void GameTreeRep::Canonicalize()
     GamePlayerRep *player = (pl) ? m_players[pl] : m_chance;
 
     // Sort nodes within information sets according to ID.
-    // Coded using a bubble sort for simplicity; large games might
-    // find a quicksort worthwhile.
-    for (int iset = 1; iset <= player->m_infosets.Length(); iset++) {
-      GameTreeInfosetRep *infoset = player->m_infosets[iset];
-      for (int i = 1; i < infoset->m_members.Length(); i++) {
-        for (int j = 1; j < infoset->m_members.Length() - i; j++) {
-          if (infoset->m_members[j + 1]->number < infoset->m_members[j]->number) {
-            GameTreeNodeRep *tmp = infoset->m_members[j];
-            infoset->m_members[j] = infoset->m_members[j + 1];
-            infoset->m_members[j + 1] = tmp;
-          }
-        }
+    for (auto infoset : player->m_infosets) {
+      std::vector<GameTreeNodeRep *> members(infoset->m_members.begin(),
+                                             infoset->m_members.end());
+      std::sort(members.begin(), members.end(),
+                [](const GameTreeNodeRep *a, const GameTreeNodeRep *b) {
+                  return a->number < b->number;
+                });
+      for (int i = 1; i <= infoset->m_members.Length(); i++) {
+        infoset->m_members[i] = members[i - 1];
       }
     }
 
-    // Sort information sets by the smallest ID among their members
-    // Coded using a bubble sort for simplicity; large games might
-    // find a quicksort worthwhile.
-    for (int i = 1; i < player->m_infosets.Length(); i++) {
-      for (int j = 1; j < player->m_infosets.Length() - i; j++) {
-        int a = ((player->m_infosets[j + 1]->m_members.Length())
-                     ? player->m_infosets[j + 1]->m_members[1]->number
-                     : 0);
-        int b = ((player->m_infosets[j]->m_members.Length())
-                     ? player->m_infosets[j]->m_members[1]->number
-                     : 0);
-
-        if (a < b || b == 0) {
-          GameTreeInfosetRep *tmp = player->m_infosets[j];
-          player->m_infosets[j] = player->m_infosets[j + 1];
-          player->m_infosets[j + 1] = tmp;
-        }
-      }
-    }
+    // Sort information sets by the smallest ID among their members.
+    // Information sets with no members go last, in their current order.
+    std::vector<GameTreeInfosetRep *> infosets(player->m_infosets.begin(),
+                                               player->m_infosets.end());
+    std::stable_sort(infosets.begin(), infosets.end(),
+                     [](const GameTreeInfosetRep *a, const GameTreeInfosetRep *b) {
+                       return !a->m_members.empty() &&
+                              (b->m_members.empty() ||
+                               a->m_members.front()->number < b->m_members.front()->number);
+                     });
 
     // Reassign information set IDs
     for (int iset = 1; iset <= player->m_infosets.Length(); iset++) {
+      player->m_infosets[iset] = infosets[iset - 1];
       player->m_infosets[iset]->m_number = iset;
     }
   }
@@ -935,7 +1138,7 @@ std::string EscapeQuotes(const std::string &s)
   return ret;
 }
 
-void PrintActions(std::ostream &p_stream, GameTreeInfosetRep *p_infoset)
+void PrintActions(std::ostream &p_stream, const GameTreeInfosetRep *p_infoset)
 {
   p_stream << "{ ";
   for (int act = 1; act <= p_infoset->NumActions(); act++) {
@@ -947,67 +1150,57 @@ void PrintActions(std::ostream &p_stream, GameTreeInfosetRep *p_infoset)
   p_stream << "}";
 }
 
-void WriteEfgFile(std::ostream &f, GameTreeNodeRep *n)
+void WriteOutcome(std::ostream &f, const GameOutcomeRep *p_outcome, int p_numPlayers)
 {
-  if (n->NumChildren() == 0) {
-    f << "t \"" << EscapeQuotes(n->GetLabel()) << "\" ";
-    if (n->GetOutcome()) {
-      f << n->GetOutcome()->GetNumber() << " \"" << EscapeQuotes(n->GetOutcome()->GetLabel())
-        << "\" ";
-      f << "{ ";
-      for (int pl = 1; pl <= n->GetGame()->NumPlayers(); pl++) {
-        f << static_cast<std::string>(n->GetOutcome()->GetPayoff(pl));
+  if (!p_outcome) {
+    f << "0\n";
+    return;
+  }
+  f << p_outcome->GetNumber() << " \"" << EscapeQuotes(p_outcome->GetLabel()) << "\" ";
+  f << "{ ";
+  for (int pl = 1; pl <= p_numPlayers; pl++) {
+    f << static_cast<std::string>(p_outcome->GetPayoff(pl));
 
-        if (pl < n->GetGame()->NumPlayers()) {
-          f << ", ";
-        }
-        else {
-          f << " }\n";
-        }
-      }
+    if (pl < p_numPlayers) {
+      f << ", ";
     }
     else {
-      f << "0\n";
+      f << " }\n";
     }
-    return;
   }
+}
 
-  if (n->GetInfoset()->IsChanceInfoset()) {
-    f << "c \"";
-  }
-  else {
-    f << "p \"";
-  }
+/// The file lists the nodes of the subtree in preorder, which is the order of
+/// the compiled tree, so the subtree is written by a single sweep over its range.
+void WriteEfgFile(std::ostream &f, const CompiledGameTree &p_tree, const GameTreeNodeRep *p_root)
+{
+  const int root = std::find(p_tree.m_nodes.begin(), p_tree.m_nodes.end(), p_root) -
+                   p_tree.m_nodes.begin();
+  for (int i = root; i < p_tree.m_subtreeEnd[root]; i++) {
+    const GameTreeNodeRep *n = p_tree.m_nodes[i];
+    if (p_tree.m_childStart[i] == p_tree.m_childStart[i + 1]) {
+      f << "t \"" << EscapeQuotes(n->GetLabel()) << "\" ";
+      WriteOutcome(f, p_tree.m_outcomes[i], p_tree.m_numPlayers);
+      continue;
+    }
 
-  f << EscapeQuotes(n->GetLabel()) << "\" ";
-  if (!n->GetInfoset()->IsChanceInfoset()) {
-    f << n->GetInfoset()->GetPlayer()->GetNumber() << ' ';
-  }
-  f << n->GetInfoset()->GetNumber() << " \"" << EscapeQuotes(n->GetInfoset()->GetLabel()) << "\" ";
-  PrintActions(f, dynamic_cast<GameTreeInfosetRep *>(n->GetInfoset().operator->()));
-  f << " ";
-  if (n->GetOutcome()) {
-    f << n->GetOutcome()->GetNumber() << " \"" << EscapeQuotes(n->GetOutcome()->GetLabel())
-      << "\" ";
-    f << "{ ";
-    for (int pl = 1; pl <= n->GetGame()->NumPlayers(); pl++) {
-      f << static_cast<std::string>(n->GetOutcome()->GetPayoff(pl));
+    const GameTreeInfosetRep *infoset = p_tree.m_infosets[i];
+    if (p_tree.m_players[i] == 0) {
+      f << "c \"";
+    }
+    else {
+      f << "p \"";
+    }
 
-      if (pl < n->GetGame()->NumPlayers()) {
-        f << ", ";
-      }
-      else {
-        f << " }\n";
-      }
+    f << EscapeQuotes(n->GetLabel()) << "\" ";
+    if (p_tree.m_players[i] != 0) {
+      f << p_tree.m_players[i] << ' ';
     }
+    f << infoset->GetNumber() << " \"" << EscapeQuotes(infoset->GetLabel()) << "\" ";
+    PrintActions(f, infoset);
+    f << " ";
+    WriteOutcome(f, p_tree.m_outcomes[i], p_tree.m_numPlayers);
   }
-  else {
-    f << "0\n";
-  }
-
-  for (int i = 1; i <= n->NumChildren();
-       WriteEfgFile(f, dynamic_cast<GameTreeNodeRep *>(n->GetChild(i++).operator->())))
-    ;
 }
 
 } // end anonymous namespace
@@ -1022,7 +1215,7 @@ void GameTreeRep::WriteEfgFile(std::ostream &p_file) const
   p_file << "}\n";
   p_file << "\"" << EscapeQuotes(GetComment()) << "\"\n\n";
 
-  Gambit::WriteEfgFile(p_file, m_root);
+  Gambit::WriteEfgFile(p_file, GetCompiledTree(), m_root);
 }
 
 void GameTreeRep::WriteEfgFile(std::ostream &p_file, const GameNode &p_root) const
@@ -1035,7 +1228,8 @@ void GameTreeRep::WriteEfgFile(std::ostream &p_file, const GameNode &p_root) con
   p_file << "}\n";
   p_file << "\"" << EscapeQuotes(GetComment()) << "\"\n\n";
 
-  Gambit::WriteEfgFile(p_file, dynamic_cast<GameTreeNodeRep *>(p_root.operator->()));
+  Gambit::WriteEfgFile(p_file, GetCompiledTree(),
+                       dynamic_cast<GameTreeNodeRep *>(p_root.operator->()));
 }
 
 void GameTreeRep::WriteNfgFile(std::ostream &p_file) const
@@ -1107,7 +1301,7 @@ GamePlayer GameTreeRep::NewPlayer()
   player = new GamePlayerRep(this, m_players.size() + 1);
   m_players.push_back(player);
   for (int outc = 1; outc <= m_outcomes.Last(); outc++) {
-    m_outcomes[outc]->m_payoffs.push_back(Number());
+    m_outcomes[outc]->m_payoffs.push_back(m_numbers.Zero());
   }
   ClearComputedValues();
   return player;
@@ -1176,7 +1370,11 @@ void GameTreeRep::DeleteOutcome(const GameOutcome &p_outcome)
 {
   IncrementVersion();
   m_root->DeleteOutcome(p_outcome);
-  m_outcomes.Remove(m_outcomes.Find(p_outcome))->Invalidate();
+  GameOutcomeRep *outcome = m_outcomes.Remove(m_outcomes.Find(p_outcome));
+  for (auto payoff : outcome->m_payoffs) {
+    m_numbers.Release(payoff);
+  }
+  outcome->Invalidate();
   for (int outc = 1; outc <= m_outcomes.Length(); outc++) {
     m_outcomes[outc]->m_number = outc;
   }
@@ -1200,6 +1398,156 @@ int CountNodes(GameNode p_node)
 
 int GameTreeRep::NumNodes() const { return CountNodes(m_root); }
 
+const CompiledGameTree &GameTreeRep::GetCompiledTree() const
+{
+  if (m_compiledValid && m_compiledVersion == m_version) {
+    return m_compiled;
+  }
+  CompiledGameTree &tree = m_compiled;
+  tree = CompiledGameTree();
+  tree.m_numPlayers = m_players.Length();
+
+  // Lay out the nodes in preorder, recording the parent of each
+  std::vector<std::pair<GameTreeNodeRep *, int>> stack{{m_root, -1}};
+  while (!stack.empty()) {
+    auto [node, parent] = stack.back();
+    stack.pop_back();
+    const int index = tree.NumNodes();
+    tree.m_nodes.push_back(node);
+    tree.m_parents.push_back(parent);
+    for (int i = node->children.Length(); i >= 1; i--) {
+      stack.emplace_back(node->children[i], index);
+    }
+  }
+
+  // Children are visited in action order in the preorder, so appending each
+  // node to its parent's range lists the children in order
+  const int numNodes = tree.NumNodes();
+  tree.m_childStart.resize(numNodes + 1);
+  tree.m_childStart[0] = 0;
+  for (int i = 0; i < numNodes; i++) {
+    tree.m_childStart[i + 1] = tree.m_childStart[i] + tree.m_nodes[i]->children.Length();
+  }
+  tree.m_children.resize(tree.m_childStart.back());
+  tree.m_priorActions.assign(numNodes, 0);
+  std::vector<int> next(tree.m_childStart.begin(), std::prev(tree.m_childStart.end()));
+  for (int i = 1; i < numNodes; i++) {
+    const int parent = tree.m_parents[i];
+    tree.m_priorActions[i] = next[parent] - tree.m_childStart[parent] + 1;
+    tree.m_children[next[parent]++] = i;
+  }
+  tree.m_subtreeEnd.resize(numNodes);
+  for (int i = numNodes - 1; i >= 0; i--) {
+    tree.m_subtreeEnd[i] = (tree.m_childStart[i] == tree.m_childStart[i + 1])
+                               ? i + 1
+                               : tree.m_subtreeEnd[tree.m_children[tree.m_childStart[i + 1] - 1]];
+  }
+
+  std::vector<int> infosetOffsets(tree.m_numPlayers + 1);
+  tree.m_numInfosets = m_chance->m_infosets.Length();
+  for (int pl = 1; pl <= tree.m_numPlayers; pl++) {
+    infosetOffsets[pl] = tree.m_numInfosets;
+    tree.m_numInfosets += m_players[pl]->m_infosets.Length();
+  }
+
+  tree.m_chanceProbs.assign(tree.m_children.size(), 0.0);
+  tree.m_payoffs.assign(numNodes * tree.m_numPlayers, 0.0);
+  for (int i = 0; i < numNodes; i++) {
+    const GameTreeNodeRep *node = tree.m_nodes[i];
+    tree.m_infosets.push_back(node->infoset);
+    tree.m_players.push_back((node->infoset) ? node->infoset->m_player->GetNumber() : -1);
+    tree.m_infosetIds.push_back(
+        (node->infoset) ? infosetOffsets[tree.m_players.back()] + node->infoset->m_number - 1
+                        : -1);
+    if (node->infoset && node->infoset->m_player->IsChance()) {
+      for (int act = 1; act <= node->children.Length(); act++) {
+        tree.m_chanceProbs[tree.m_childStart[i] + act - 1] =
+            static_cast<double>(node->infoset->m_probs[act]);
+      }
+    }
+    tree.m_outcomes.push_back(node->outcome);
+    if (node->outcome) {
+      for (int pl = 1; pl <= tree.m_numPlayers; pl++) {
+        tree.m_payoffs[i * tree.m_numPlayers + pl - 1] =
+            static_cast<double>(node->outcome->GetPayoff(pl));
+      }
+    }
+  }
+
+  // A node is the root of a subgame exactly when every information set of a
+  // player with a member in its subtree has all its members there; that is,
+  // when the members of the information sets met in the subtree all lie in
+  // its preorder interval.
+  std::vector<int> firstMember(tree.m_numInfosets, numNodes), lastMember(tree.m_numInfosets, -1);
+  for (int i = 0; i < numNodes; i++) {
+    if (tree.m_players[i] > 0) {
+      firstMember[tree.m_infosetIds[i]] = std::min(firstMember[tree.m_infosetIds[i]], i);
+      lastMember[tree.m_infosetIds[i]] = std::max(lastMember[tree.m_infosetIds[i]], i);
+    }
+  }
+  std::vector<int> low(numNodes), high(numNodes);
+  for (int i = 0; i < numNodes; i++) {
+    low[i] = (tree.m_players[i] > 0) ? firstMember[tree.m_infosetIds[i]] : i;
+    high[i] = (tree.m_players[i] > 0) ? lastMember[tree.m_infosetIds[i]] : i;
+  }
+  for (int i = numNodes - 1; i > 0; i--) {
+    low[tree.m_parents[i]] = std::min(low[tree.m_parents[i]], low[i]);
+    high[tree.m_parents[i]] = std::max(high[tree.m_parents[i]], high[i]);
+  }
+  tree.m_subgameRoots.resize(numNodes);
+  for (int i = 0; i < numNodes; i++) {
+    tree.m_subgameRoots[i] = (tree.m_infosets[i] && tree.m_infosets[i]->m_members.Length() == 1 &&
+                              low[i] >= i && high[i] < tree.m_subtreeEnd[i]);
+  }
+
+  // A player has perfect recall exactly when all members of each of their
+  // information sets are reached by the same sequence of the player's own
+  // moves.  Each such sequence is identified by a node in a trie of
+  // (information set, action) pairs, with 0 the empty sequence.
+  std::vector<int> histories(numNodes * tree.m_numPlayers, 0);
+  std::map<std::tuple<int, int, int>, int> trie;
+  std::vector<int> trieMoves{-1}, trieDepths{0};
+  std::vector<int> infosetHistories(tree.m_numInfosets, -1);
+  for (int i = 0; i < numNodes && tree.m_perfectRecall; i++) {
+    int *history = &histories[i * tree.m_numPlayers];
+    if (i > 0) {
+      const int parent = tree.m_parents[i];
+      std::copy_n(&histories[parent * tree.m_numPlayers], tree.m_numPlayers, history);
+      const int mover = tree.m_players[parent];
+      if (mover > 0) {
+        int &last = history[mover - 1];
+        auto entry = trie.emplace(
+            std::make_tuple(last, tree.m_infosetIds[parent], tree.m_priorActions[i]),
+            static_cast<int>(trieMoves.size()));
+        if (entry.second) {
+          trieMoves.push_back(parent);
+          trieDepths.push_back(trieDepths[last] + 1);
+        }
+        last = entry.first->second;
+      }
+    }
+    const int pl = tree.m_players[i];
+    if (pl <= 0) {
+      continue;
+    }
+    int &seen = infosetHistories[tree.m_infosetIds[i]];
+    if (seen < 0) {
+      seen = history[pl - 1];
+    }
+    else if (seen != history[pl - 1]) {
+      // Report the information set of the last move in the longer sequence
+      const int longer = (trieDepths[history[pl - 1]] >= trieDepths[seen]) ? history[pl - 1] : seen;
+      tree.m_perfectRecall = false;
+      tree.m_recallInfoset1 = tree.m_infosets[trieMoves[longer]];
+      tree.m_recallInfoset2 = tree.m_infosets[i];
+    }
+  }
+
+  m_compiledValid = true;
+  m_compiledVersion = m_version;
+  return m_compiled;
+}
+
 //------------------------------------------------------------------------
 //                       GameTreeRep: Modification
 //------------------------------------------------------------------------
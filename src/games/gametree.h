@@ -63,6 +63,8 @@ class GameTreeInfosetRep : public GameInfosetRep {
   friend class GamePlayerRep;
   friend class GameTreeNodeRep;
   template <class T> friend class MixedBehaviorProfile;
+  template <class T> friend class TreeMixedStrategyProfileRep;
+  friend class CompiledGameTree;
 
 protected:
   GameTreeRep *m_efg;
@@ -132,6 +134,7 @@ class GameTreeNodeRep : public GameNodeRep {
   friend class GamePlayerRep;
   friend class PureBehaviorProfile;
   template <class T> friend class MixedBehaviorProfile;
+  template <class T> friend class TreeMixedStrategyProfileRep;
 
 protected:
   int number;
@@ -203,6 +206,67 @@ public:
   GameInfoset InsertMove(GameInfoset p_infoset) override;
 };
 
+///
+/// A compiled, read-only view of the structure of a game tree.  The nodes are
+/// laid out in preorder, so that node i is the node numbered i + 1, and their
+/// attributes are held in parallel arrays, so that passes over the tree can
+/// iterate linearly rather than recursing through the nodes.  Parents precede
+/// their children; iterating in reverse visits children before their parents.
+///
+class CompiledGameTree {
+public:
+  /// The number of players in the game (excluding chance)
+  int m_numPlayers{0};
+  /// The nodes, in preorder
+  std::vector<GameTreeNodeRep *> m_nodes;
+  /// The parent of each node, or -1 for the root
+  std::vector<int> m_parents;
+  /// The children of node i are m_children[m_childStart[i]], ...,
+  /// m_children[m_childStart[i + 1] - 1], in the order of the actions leading to them
+  std::vector<int> m_childStart, m_children;
+  /// The number of the action leading to each node, or 0 at the root
+  std::vector<int> m_priorActions;
+  /// One past the last node in the subtree rooted at each node
+  std::vector<int> m_subtreeEnd;
+  /// The information set at each node, or null at terminal nodes
+  std::vector<GameTreeInfosetRep *> m_infosets;
+  /// The number of information sets in the tree, including those of chance
+  int m_numInfosets{0};
+  /// A dense index of the information set at each node, numbering those of
+  /// chance first and then those of each player in turn; -1 at terminal nodes
+  std::vector<int> m_infosetIds;
+  /// The player to move at each node: 0 for chance, and -1 at terminal nodes
+  std::vector<int> m_players;
+  /// The probability of the action leading to each child of a chance node,
+  /// indexed as m_children; zero for children of personal player nodes
+  std::vector<double> m_chanceProbs;
+  /// The outcome at each node, or null if there is none
+  std::vector<GameOutcomeRep *> m_outcomes;
+  /// The payoff of the outcome at each node to each player, m_numPlayers per
+  /// node; zero at nodes without an outcome
+  std::vector<double> m_payoffs;
+  /// Whether each node is the root of a subgame
+  std::vector<bool> m_subgameRoots;
+  /// Whether the game has perfect recall; if not, a pair of information sets
+  /// exhibiting the failure
+  bool m_perfectRecall{true};
+  GameTreeInfosetRep *m_recallInfoset1{nullptr}, *m_recallInfoset2{nullptr};
+
+  /// Returns the number of nodes in the tree
+  int NumNodes() const { return static_cast<int>(m_nodes.size()); }
+  /// Returns the index of the node, looked up by its number, or -1 if the
+  /// numbering of the nodes is out of date
+  int IndexOf(const GameTreeNodeRep *p_node) const
+  {
+    const int index = p_node->GetNumber() - 1;
+    return (index >= 0 && index < NumNodes() && m_nodes[index] == p_node) ? index : -1;
+  }
+  /// Returns the probability of action p_action at the chance node p_node
+  template <class T> T GetChanceProb(int p_node, int p_action) const;
+  /// Returns the payoff to player pl of the outcome at p_node, or zero if none
+  template <class T> T GetPayoff(int p_node, int pl) const;
+};
+
 class GameTreeRep : public GameExplicitRep {
   friend class GameTreeNodeRep;
   friend class GameTreeInfosetRep;
@@ -213,6 +277,15 @@ protected:
   GameTreeNodeRep *m_root;
   GamePlayerRep *m_chance;
 
+  /// @name Compiled view of the tree
+  ///
+  /// Built on demand, and rebuilt whenever the game version changes.
+  //@{
+  mutable CompiledGameTree m_compiled;
+  mutable bool m_compiledValid{false};
+  mutable unsigned int m_compiledVersion{0};
+  //@}
+
   /// @name Private auxiliary functions
   //@{
   void NumberNodes(GameTreeNodeRep *, int &);
@@ -265,6 +338,9 @@ public:
   GameNode GetRoot() const override { return m_root; }
   /// Returns the number of nodes in the game
   int NumNodes() const override;
+  /// Returns a compiled view of the tree.  The reference is invalidated by
+  /// any subsequent change to the game.
+  const CompiledGameTree &GetCompiledTree() const;
   //@}
 
   void DeleteOutcome(const GameOutcome &) override;
@@ -312,6 +388,33 @@ public:
   NewMixedStrategyProfile(const Rational &, const StrategySupportProfile &) const override;
 };
 
+template <class T> T CompiledGameTree::GetChanceProb(int p_node, int p_action) const
+{
+  return static_cast<T>(m_infosets[p_node]->m_probs[p_action]);
+}
+
+template <> inline double CompiledGameTree::GetChanceProb(int p_node, int p_action) const
+{
+  return m_chanceProbs[m_childStart[p_node] + p_action - 1];
+}
+
+template <class T> T CompiledGameTree::GetPayoff(int p_node, int pl) const
+{
+  return (m_outcomes[p_node]) ? static_cast<T>(m_outcomes[p_node]->GetPayoff(pl)) : T(0);
+}
+
+template <> inline double CompiledGameTree::GetPayoff(int p_node, int pl) const
+{
+  return m_payoffs[p_node * m_numPlayers + pl - 1];
+}
+
+///
+/// A mixed strategy profile on a game tree.  Payoffs are computed directly from
+/// the tree using each player's sequences: a strategy is consistent with reaching
+/// a node exactly when it is consistent with the player's last sequence on the
+/// path to the node, so the probability the node is reached is a product over
+/// players of the total weight of the strategies consistent with their sequences.
+///
 template <class T> class TreeMixedStrategyProfileRep : public MixedStrategyProfileRep<T> {
 public:
   explicit TreeMixedStrategyProfileRep(const StrategySupportProfile &p_support)
@@ -323,13 +426,30 @@ public:
 
   MixedStrategyProfileRep<T> *Copy() const override;
   T GetPayoff(int pl) const override;
+  Vector<T> GetPayoffs() const override;
+  PVector<T> GetStrategyValues() const override;
   T GetPayoffDeriv(int pl, const GameStrategy &) const override;
   T GetPayoffDeriv(int pl, const GameStrategy &, const GameStrategy &) const override;
+  Matrix<T> GetStrategyValueDerivs() const override;
 
   void InvalidateCache() const override;
 
 protected:
-  mutable std::shared_ptr<MixedBehaviorProfile<T>> mixed_behav_profile_sptr;
+  class Sequences;
+
+  /// The sequence structure of the tree, shared among copies of the profile
+  mutable std::shared_ptr<const Sequences> m_sequences;
+  /// For each player, the total probability of the strategies consistent with
+  /// each of the player's sequences; empty if not computed for the current profile
+  mutable std::vector<std::vector<T>> m_sequenceWeights;
+
+  /// Returns the sequence structure of the tree, building it if required
+  const Sequences &GetSequences() const;
+  /// Computes the weights of each player's sequences, if not current
+  void ComputeSequenceWeights() const;
+  /// Returns the product of the sequence weights at a terminal record, omitting
+  /// the players p_skip1 and p_skip2
+  T GetOtherWeights(const int *p_sequences, int p_skip1, int p_skip2 = 0) const;
 };
 
 } // namespace Gambit
@@ -23,6 +23,11 @@
 #ifndef LIBGAMBIT_NUMBER_H
 #define LIBGAMBIT_NUMBER_H
 
+#include <iterator>
+#include <list>
+#include <string_view>
+#include <unordered_map>
+
 namespace Gambit {
 
 /// This class represents a numerical data value in a game.
@@ -86,6 +91,87 @@ public:
   explicit operator const std::string &() const { return m_text; }
 };
 
+/// This class holds each distinct numerical data value used in a game once.
+///
+/// Games typically use only a few distinct payoffs, repeated in many outcomes;
+/// outcomes therefore refer to the values held here rather than holding copies.
+/// Values are looked up by their text representation, so that a value which
+/// is repeated is converted to a rational number only the first time it is seen.
+/// Each value counts the references to it obtained from Intern() or Zero(), and
+/// is removed when the last of these is given back by Release(), so that
+/// values which are overwritten do not accumulate.  The value "0" is always held.
+class NumberStore {
+private:
+  struct Entry {
+    Number m_value;
+    int m_refs;
+  };
+
+  std::list<Entry> m_values;
+  std::unordered_map<std::string_view, std::list<Entry>::iterator> m_index;
+
+public:
+  /// Construct a new store, holding the value "0"
+  NumberStore() { Insert(Number()); }
+  NumberStore(const NumberStore &) = delete;
+  ~NumberStore() = default;
+
+  NumberStore &operator=(const NumberStore &) = delete;
+
+  /// Returns the stored value with representation "0"
+  const Number *Zero()
+  {
+    m_values.front().m_refs++;
+    return &m_values.front().m_value;
+  }
+
+  /// Returns the stored value with representation p_text, adding it if needed
+  /// @param p_text The text representation of the number
+  const Number *Intern(const std::string &p_text)
+  {
+    auto entry = m_index.find(p_text);
+    if (entry != m_index.end()) {
+      entry->second->m_refs++;
+      return &entry->second->m_value;
+    }
+    return Insert(Number(p_text));
+  }
+  /// Returns the stored value with the same representation as p_value,
+  /// adding it if needed
+  const Number *Intern(const Number &p_value)
+  {
+    auto entry = m_index.find(static_cast<const std::string &>(p_value));
+    if (entry != m_index.end()) {
+      entry->second->m_refs++;
+      return &entry->second->m_value;
+    }
+    return Insert(p_value);
+  }
+  /// Gives back a reference to a value obtained from Intern() or Zero()
+  /// @param p_value The stored value
+  void Release(const Number *p_value)
+  {
+    auto entry = m_index.find(static_cast<const std::string &>(*p_value));
+    if (--entry->second->m_refs == 0) {
+      auto value = entry->second;
+      m_index.erase(entry);
+      m_values.erase(value);
+    }
+  }
+
+  /// Returns the number of distinct values held
+  size_t NumValues() const { return m_values.size(); }
+
+private:
+  const Number *Insert(const Number &p_value)
+  {
+    m_values.push_back({p_value, 1});
+    auto value = std::prev(m_values.end());
+    m_index.emplace(static_cast<const std::string &>(value->m_value), value);
+    return &value->m_value;
+  }
+};
+
 } // namespace Gambit
 
 #endif // LIBGAMBIT_NUMBER_H
@@ -53,8 +53,22 @@ public:
   }
 
   virtual T GetPayoff(int pl) const = 0;
+  /// Returns the payoffs to all players, indexed by player number
+  virtual Vector<T> GetPayoffs() const;
+  /// Returns the payoff to each strategy in the game, indexed by player and strategy number
+  virtual PVector<T> GetStrategyValues() const;
   virtual T GetPayoffDeriv(int pl, const GameStrategy &) const = 0;
   virtual T GetPayoffDeriv(int pl, const GameStrategy &, const GameStrategy &) const = 0;
+  /// Returns the change in the payoff to each strategy in the game, indexed by player
+  /// and strategy number, if the probabilities of p_player's strategies are changed
+  /// by p_delta (indexed by strategy number).  The entries for p_player are zero.
+  virtual PVector<T> GetStrategyValueChanges(int p_player, const Vector<T> &p_delta) const;
+  /// Returns true if GetStrategyValueChanges() costs less than computing the strategy
+  /// values in full; otherwise, changes to the profile discard the cached values
+  virtual bool HasFastStrategyValueChanges() const { return false; }
+  /// Returns the derivatives of each strategy's value with respect to each strategy's
+  /// probability, indexed by strategy id
+  virtual Matrix<T> GetStrategyValueDerivs() const;
 
   T GetPayoff(const GamePlayer &p_player) const { return GetPayoff(p_player->GetNumber()); }
   T GetPayoff(const GameStrategy &p_strategy) const
@@ -78,6 +92,22 @@ template <class T> class MixedStrategyProfile {
 private:
   MixedStrategyProfileRep<T> *m_rep;
 
+  /// @name Cached payoffs and strategy values
+  //@{
+  /// Payoffs to each player, indexed by player number less one
+  mutable std::vector<T> m_payoffs;
+  /// Payoffs to each strategy, indexed by strategy id less one
+  mutable std::vector<T> m_strategyValues;
+  /// Whether the cached payoffs and strategy values are current
+  mutable bool m_cacheValid{false};
+  /// Number of times the cache has been corrected by IncrementStrategyProbs()
+  /// since it was last computed in full
+  mutable int m_numIncrements{0};
+
+  /// Computes the cached payoffs from the cached strategy values
+  void UpdatePayoffs() const;
+  //@}
+
 public:
   /// @name Lifecycle
   //@{
@@ -162,6 +192,27 @@ public:
   /// Returns the mixed strategy for the player
   Vector<T> operator[](const GamePlayer &p_player) const;
 
+  /// @brief Changes the probabilities with which one player's strategies are played
+  /// @details Adds p_delta, indexed by strategy number, to the probabilities of the
+  ///          strategies of p_player.  Unlike assigning probabilities one at a time,
+  ///          this keeps any cached payoffs and strategy values: the player's own
+  ///          strategy values do not depend on their own mixture, and those of the
+  ///          other players change linearly in it, so the cache is corrected in place
+  ///          at the cost of contracting only the slices of the table where p_player
+  ///          plays a strategy whose probability changed.  For representations
+  ///          without such a shortcut (see HasFastStrategyValueChanges()), the cache
+  ///          is discarded instead.
+  /// @param[in] p_player  The player whose mixed strategy is changed.
+  /// @param[in] p_delta   The change in the probability of each of the player's strategies.
+  ///                      Entries for strategies not in the support must be zero.
+  void IncrementStrategyProbs(const GamePlayer &p_player, const Vector<T> &p_delta);
+  /// @brief Sets the probabilities with which one player's strategies are played
+  /// @details As IncrementStrategyProbs(), keeps any cached payoffs and strategy values.
+  /// @param[in] p_player  The player whose mixed strategy is set.
+  /// @param[in] p_probs   The probability of each of the player's strategies.
+  ///                      Entries for strategies not in the support must be zero.
+  void SetStrategyProbs(const GamePlayer &p_player, const Vector<T> &p_probs);
+
   explicit operator const Vector<T> &() const
   {
     CheckVersion();
@@ -212,13 +263,10 @@ public:
   //@{
   /// Used to read payoffs from cache or compute them and cache them if needed
   void ComputePayoffs() const;
-  mutable std::map<GamePlayer, std::map<GameStrategy, T>> map_strategy_payoffs;
-  mutable std::map<GamePlayer, T> map_profile_payoffs;
   /// Reset cache for payoffs and strategy values
   virtual void InvalidateCache() const
   {
-    map_strategy_payoffs.clear();
-    map_profile_payoffs.clear();
+    m_cacheValid = false;
     m_rep->InvalidateCache();
   }
 
@@ -236,6 +284,10 @@ public:
     return GetPayoff(p_player->GetNumber());
   }
 
+  /// Computes the payoffs of the profile to all players, indexed by player number.
+  /// These are read from the cache if it is current, and otherwise computed directly.
+  Vector<T> GetPayoffs() const;
+
   /// \brief Computes the derivative of the player's payoff
   ///
   /// Computes the derivative of the payoff to the player with respect
@@ -256,6 +308,18 @@ public:
     return m_rep->GetPayoffDeriv(pl, s1, s2);
   }
 
+  /// @brief Computes the derivatives of all strategy values
+  /// @details Computes the matrix whose (s, t) entry is the derivative of the payoff
+  ///          to playing strategy s with respect to the probability that strategy t
+  ///          is played; that is, GetPayoffDeriv(pl, s, t) where pl is the player
+  ///          owning s.  Rows and columns are indexed by strategy id.  Entries
+  ///          for pairs of strategies of the same player are zero.
+  Matrix<T> GetStrategyValueDerivs() const
+  {
+    CheckVersion();
+    return m_rep->GetStrategyValueDerivs();
+  }
+
   /// Computes the payoff to playing the pure strategy against the profile
   T GetPayoff(const GameStrategy &p_strategy) const
   {
@@ -263,6 +327,15 @@ public:
     return GetPayoffDeriv(p_strategy->GetPlayer()->GetNumber(), p_strategy);
   }
 
+  /// @brief Computes the payoffs to playing each pure strategy against the profile
+  /// @details Computes, for every strategy in the game, the payoff to its player of
+  ///          playing that strategy against the profile.  The result is indexed by
+  ///          player number and strategy number.  This is equivalent to, but
+  ///          usually much faster than, calling GetPayoff() on each strategy.
+  ///          The values are cached with the profile, and kept current across
+  ///          calls to IncrementStrategyProbs().
+  PVector<T> GetStrategyValues() const;
+
   /// @brief Computes the regret to playing \p p_strategy
   /// @details Computes the regret to the player of playing strategy \p p_strategy
   ///          against the profile.  The regret is defined as the difference
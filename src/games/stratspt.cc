@@ -20,6 +20,8 @@
 // Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
 //
 
+#include <cmath>
+
 #include "gambit.h"
 #include "gametable.h"
 
@@ -226,12 +228,144 @@ bool StrategySupportProfile::RemoveStrategy(const GameStrategy &p_strategy)
 //                 Identification of dominated strategies
 //---------------------------------------------------------------------------
 
+namespace {
+
+/// The payoffs to one player in a table game, in each contingency of the
+/// strategies of the other players in a support.  Payoffs are compared as
+/// floating-point numbers where these are far enough apart to be decisive,
+/// and exactly only where they are not.
+class PayoffSlices {
+public:
+  PayoffSlices(const StrategySupportProfile &p_support, const GamePlayer &p_player);
+
+  /// Does strategy number s dominate strategy number t?
+  bool Dominates(int s, int t, bool p_strict) const;
+  /// Returns the set of strategies in p_candidates, indexed by strategy number
+  /// from zero, which are not dominated by any other of p_candidates
+  std::vector<bool> Undominated(const std::vector<bool> &p_candidates, bool p_strict) const;
+
+private:
+  const double *m_doubles;
+  const Rational *m_rationals;
+  long m_stride;
+  /// The offsets into the payoff table of the contingencies of the other players
+  std::vector<long> m_contingencies;
+
+  /// Returns the sign of the difference of the payoffs at the two offsets
+  int Compare(long p_index1, long p_index2) const;
+};
+
+/// Relative difference beyond which floating-point payoffs are taken to be
+/// ordered the same way as the exact payoffs they are converted from
+constexpr double c_decisive = 1.0e-12;
+
+PayoffSlices::PayoffSlices(const StrategySupportProfile &p_support, const GamePlayer &p_player)
+  : m_contingencies(1, 0L)
+{
+  const auto &table = dynamic_cast<const GameTableRep &>(*p_support.GetGame());
+  const int pl = p_player->GetNumber();
+  m_doubles = table.GetPayoffTable<double>(pl);
+  m_rationals = table.GetPayoffTable<Rational>(pl);
+  std::vector<long> strides(1, 1L);
+  for (auto player : table.GetPlayers()) {
+    strides.push_back(strides.back() * player->NumStrategies());
+  }
+  m_stride = strides[pl - 1];
+  // Lay out the contingencies with the strategies of the lowest-numbered
+  // players varying fastest, as in the table
+  for (int other = table.NumPlayers(); other >= 1; other--) {
+    if (other == pl) {
+      continue;
+    }
+    std::vector<long> contingencies;
+    for (auto offset : m_contingencies) {
+      for (auto strategy : p_support.GetStrategies(table.GetPlayer(other))) {
+        contingencies.push_back(offset + (strategy->GetNumber() - 1) * strides[other - 1]);
+      }
+    }
+    m_contingencies.swap(contingencies);
+  }
+}
+
+int PayoffSlices::Compare(long p_index1, long p_index2) const
+{
+  const double a = m_doubles[p_index1], b = m_doubles[p_index2];
+  const double margin = c_decisive * (std::fabs(a) + std::fabs(b));
+  if (a - b > margin) {
+    return 1;
+  }
+  if (a - b < -margin) {
+    return -1;
+  }
+  const Rational &x = m_rationals[p_index1], &y = m_rationals[p_index2];
+  return (x < y) ? -1 : ((y < x) ? 1 : 0);
+}
+
+bool PayoffSlices::Dominates(int s, int t, bool p_strict) const
+{
+  const double *a = m_doubles + (s - 1) * m_stride;
+  const double *b = m_doubles + (t - 1) * m_stride;
+  // Most pairs are rejected by some contingency in which t is clearly better
+  bool worse = false;
+  for (auto offset : m_contingencies) {
+    const double x = a[offset], y = b[offset];
+    worse |= (x - y < -c_decisive * (std::fabs(x) + std::fabs(y)));
+  }
+  if (worse) {
+    return false;
+  }
+
+  bool equal = true;
+  for (auto offset : m_contingencies) {
+    const int cmp = Compare(offset + (s - 1) * m_stride, offset + (t - 1) * m_stride);
+    if (cmp < 0 || (p_strict && cmp == 0)) {
+      return false;
+    }
+    if (cmp > 0) {
+      equal = false;
+    }
+  }
+  return (p_strict || !equal);
+}
+
+std::vector<bool> PayoffSlices::Undominated(const std::vector<bool> &p_candidates,
+                                            bool p_strict) const
+{
+  // Dominance is transitive, so each dominated strategy is dominated by some
+  // undominated one; strategies already found to be dominated need not be
+  // tried as dominators.
+  std::vector<bool> undominated(p_candidates);
+  const int dim = p_candidates.size();
+  for (int t = 0; t < dim; t++) {
+    if (!p_candidates[t]) {
+      continue;
+    }
+    for (int s = 0; s < dim; s++) {
+      if (s != t && undominated[s] && Dominates(s + 1, t + 1, p_strict)) {
+        undominated[t] = false;
+        break;
+      }
+    }
+  }
+  return undominated;
+}
+
+bool IsTable(const Game &p_game) { return dynamic_cast<GameTableRep *>(p_game.operator->()); }
+
+} // end anonymous namespace
+
 bool StrategySupportProfile::Dominates(const GameStrategy &s, const GameStrategy &t,
                                        bool p_strict) const
 {
+  if (IsTable(m_nfg)) {
+    return PayoffSlices(*this, s->GetPlayer()).Dominates(s->GetNumber(), t->GetNumber(),
+                                                          p_strict);
+  }
+
   bool equal = true;
 
-  for (StrategyProfileIterator iter(*this); !iter.AtEnd(); iter++) {
+  // The values of s and t do not depend on the player's own strategy
+  for (StrategyProfileIterator iter(*this, s); !iter.AtEnd(); iter++) {
     Rational ap = (*iter)->GetStrategyValue(s);
     Rational bp = (*iter)->GetStrategyValue(t);
     if (p_strict && ap <= bp) {
@@ -253,6 +387,17 @@ bool StrategySupportProfile::Dominates(const GameStrategy &s, const GameStrategy
 bool StrategySupportProfile::IsDominated(const GameStrategy &s, bool p_strict,
                                          bool p_external) const
 {
+  if (IsTable(m_nfg)) {
+    GamePlayer player = s->GetPlayer();
+    const PayoffSlices slices(*this, player);
+    for (auto strategy : (p_external) ? player->GetStrategies() : GetStrategies(player)) {
+      if (strategy != s && slices.Dominates(strategy->GetNumber(), s->GetNumber(), p_strict)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
   if (p_external) {
     GamePlayer player = s->GetPlayer();
     for (int st = 1; st <= player->NumStrategies(); st++) {
@@ -276,6 +421,23 @@ bool StrategySupportProfile::IsDominated(const GameStrategy &s, bool p_strict,
 bool StrategySupportProfile::Undominated(StrategySupportProfile &newS, int p_player, bool p_strict,
                                          bool p_external) const
 {
+  if (IsTable(m_nfg)) {
+    GamePlayer player = m_nfg->GetPlayer(p_player);
+    std::vector<bool> candidates(player->NumStrategies(), p_external);
+    for (auto strategy : GetStrategies(player)) {
+      candidates[strategy->GetNumber() - 1] = true;
+    }
+    auto undominated = PayoffSlices(*this, player).Undominated(candidates, p_strict);
+    bool removed = false;
+    for (auto strategy : player->GetStrategies()) {
+      if (candidates[strategy->GetNumber() - 1] && !undominated[strategy->GetNumber() - 1]) {
+        newS.RemoveStrategy(strategy);
+        removed = true;
+      }
+    }
+    return removed;
+  }
+
   Array<GameStrategy> set((p_external) ? m_nfg->GetPlayer(p_player)->NumStrategies()
                                        : NumStrategies(p_player));
 
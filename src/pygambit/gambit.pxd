@@ -195,6 +195,7 @@ cdef extern from "games/game.h":
         c_GameOutcome GetOutcome(int) except +IndexError
         c_GameOutcome NewOutcome() except +
         void DeleteOutcome(c_GameOutcome) except +
+        size_t NumPayoffValues() except +
 
         int NumNodes() except +
         c_GameNode GetRoot() except +
@@ -236,6 +237,14 @@ cdef extern from "games/stratpure.h":
         c_Rational GetPayoff(c_GamePlayer) except +
 
 
+cdef extern from "games/gametable.h":
+    cdef cppclass c_BestResponseIndex "BestResponseIndex":
+        c_BestResponseIndex(c_Game) except +
+        void Build(int) except +
+        long NumContingencies() except +
+        bool IsBestResponse(int, long) except +
+
+
 cdef extern from "games/stratmixed.h":
     cdef cppclass c_MixedStrategyProfileDouble "MixedStrategyProfile<double>":
         bool operator==(c_MixedStrategyProfileDouble) except +
@@ -370,9 +379,13 @@ cdef extern from "util.h":
     void setitem_mspd_int "setitem"(c_MixedStrategyProfileDouble, int, double) except +
     void setitem_mspd_strategy "setitem"(c_MixedStrategyProfileDouble,
                                          c_GameStrategy, double) except +
+    void setitem_mspd_player "setitem_player"(c_MixedStrategyProfileDouble,
+                                              c_GamePlayer, clist[double]) except +
     void setitem_mspr_int "setitem"(c_MixedStrategyProfileRational, int, c_Rational) except +
     void setitem_mspr_strategy "setitem"(c_MixedStrategyProfileRational,
                                          c_GameStrategy, c_Rational) except +
+    void setitem_mspr_player "setitem_player"(c_MixedStrategyProfileRational,
+                                              c_GamePlayer, clist[c_Rational]) except +
 
     void setitem_mbpd_int "setitem"(c_MixedBehaviorProfileDouble, int, double) except +
     void setitem_mbpd_action "setitem"(c_MixedBehaviorProfileDouble,
@@ -401,8 +414,15 @@ cdef extern from "util.h":
     ) except +
 
 
+cdef extern from "solvers/linalg/dominance.h":
+    c_StrategySupportProfile UndominatedMixed "UndominatedMixed<Rational>"(
+            c_StrategySupportProfile, bool, bool
+    )  # except + doesn't compile
+
 cdef extern from "solvers/enumpure/enumpure.h":
-    c_List[c_MixedStrategyProfileRational] EnumPureStrategySolve(c_Game) except +RuntimeError
+    c_List[c_MixedStrategyProfileRational] EnumPureStrategySolve(
+            c_Game, int p_numThreads
+    ) except +RuntimeError
     c_List[c_MixedBehaviorProfileRational] EnumPureAgentSolve(c_Game) except +RuntimeError
 
 cdef extern from "solvers/enummixed/enummixed.h":
@@ -414,10 +434,10 @@ cdef extern from "solvers/enummixed/enummixed.h":
 
 cdef extern from "solvers/lcp/lcp.h":
     c_List[c_MixedStrategyProfileDouble] LcpStrategySolveDouble(
-            c_Game, int p_stopAfter, int p_maxDepth
+            c_Game, int p_stopAfter, int p_maxDepth, int p_numThreads
     ) except +RuntimeError
     c_List[c_MixedStrategyProfileRational] LcpStrategySolveRational(
-            c_Game, int p_stopAfter, int p_maxDepth
+            c_Game, int p_stopAfter, int p_maxDepth, int p_numThreads
     ) except +RuntimeError
     c_List[c_MixedBehaviorProfileDouble] LcpBehaviorSolveDouble(
             c_Game, int p_stopAfter, int p_maxDepth
@@ -483,7 +503,7 @@ cdef extern from "solvers/logit/logit.h":
 
 cdef extern from "nash.h":
     c_List[c_MixedBehaviorProfileDouble] LogitBehaviorSolveWrapper(
-            c_Game, double, double, double
+            c_Game, double, double, double, bool
     ) except +
     c_List[c_LogitQREMixedBehaviorProfile] LogitBehaviorPrincipalBranchWrapper(
             c_Game, double, double, double
@@ -495,7 +515,7 @@ cdef extern from "nash.h":
             shared_ptr[c_MixedBehaviorProfileDouble], bool, double, double
     ) except +
     c_List[c_MixedStrategyProfileDouble] LogitStrategySolveWrapper(
-            c_Game, double, double, double
+            c_Game, double, double, double, bool
     ) except +
     c_List[c_LogitQREMixedStrategyProfile] LogitStrategyPrincipalBranchWrapper(
             c_Game, double, double, double
@@ -506,3 +526,9 @@ cdef extern from "nash.h":
     shared_ptr[c_LogitQREMixedStrategyProfile] LogitStrategyEstimateWrapper(
             shared_ptr[c_MixedStrategyProfileDouble], bool, double, double
     ) except +
+    clist[clist[shared_ptr[c_LogitQREMixedStrategyProfile]]] LogitStrategyAtLambdaBatchWrapper(
+            c_Game, clist[clist[double]], double, double, int
+    ) except +
+    clist[shared_ptr[c_LogitQREMixedStrategyProfile]] LogitStrategyEstimateBatchWrapper(
+            clist[shared_ptr[c_MixedStrategyProfileDouble]], bool, double, double, int
+    ) except +
@@ -545,6 +545,11 @@ class Game:
         c.game = self.game
         return c
 
+    @property
+    def _num_payoff_values(self) -> int:
+        """The number of distinct payoff values held by the game."""
+        return self.game.deref().NumPayoffValues()
+
     @property
     def contingencies(self) -> pygambit.gameiter.Contingencies:
         """An iterator over the contingencies in the game."""
@@ -633,6 +638,19 @@ class Game:
                 "set_chance_probs(): must specify non-negative probabilities that sum to one"
             ) from None
 
+    def _best_responses(self, threads: int = 1) -> typing.List[typing.List[bool]]:
+        """For each player of a strategic game, whether the player's strategy in each
+        contingency is a best response, with contingencies in the order of the dense
+        payoff tables (the first player's strategy varying fastest)."""
+        index = cython.declare(shared_ptr[c_BestResponseIndex])
+        index = make_shared[c_BestResponseIndex](self.game)
+        deref(index).Build(threads)
+        responses = []
+        for pl in range(len(self.players)):
+            responses.append([deref(index).IsBestResponse(pl + 1, cont)
+                              for cont in range(deref(index).NumContingencies())])
+        return responses
+
     def _get_contingency(self, *args):
         psp = cython.declare(shared_ptr[c_PureStrategyProfile])
         psp = make_shared[c_PureStrategyProfile](self.game.deref().NewPureStrategyProfile())
@@ -27,11 +27,12 @@ using namespace std;
 using namespace Gambit;
 
 List<MixedBehaviorProfile<double>> LogitBehaviorSolveWrapper(const Game &p_game, double p_regret,
-                                                             double p_firstStep, double p_maxAccel)
+                                                             double p_firstStep, double p_maxAccel,
+                                                             bool p_broyden)
 {
   List<MixedBehaviorProfile<double>> ret;
   ret.push_back(LogitBehaviorSolve(LogitQREMixedBehaviorProfile(p_game), p_regret, 1.0,
-                                   p_firstStep, p_maxAccel)
+                                   p_firstStep, p_maxAccel, NullMixedBehaviorObserver, p_broyden)
                     .back()
                     .GetProfile());
   return ret;
@@ -67,11 +68,12 @@ LogitBehaviorAtLambdaWrapper(const Game &p_game, const std::list<double> &p_targ
 }
 
 List<MixedStrategyProfile<double>> LogitStrategySolveWrapper(const Game &p_game, double p_regret,
-                                                             double p_firstStep, double p_maxAccel)
+                                                             double p_firstStep, double p_maxAccel,
+                                                             bool p_broyden)
 {
   List<MixedStrategyProfile<double>> ret;
   ret.push_back(LogitStrategySolve(LogitQREMixedStrategyProfile(p_game), p_regret, 1.0,
-                                   p_firstStep, p_maxAccel)
+                                   p_firstStep, p_maxAccel, NullMixedStrategyObserver, p_broyden)
                     .back()
                     .GetProfile());
   return ret;
@@ -105,3 +107,36 @@ LogitStrategyEstimateWrapper(std::shared_ptr<MixedStrategyProfile<double>> p_fre
   return make_shared<LogitQREMixedStrategyProfile>(LogitStrategyEstimate(
       *p_frequencies, 1000000.0, 1.0, p_stopAtLocal, p_firstStep, p_maxAccel));
 }
+
+std::list<std::list<std::shared_ptr<LogitQREMixedStrategyProfile>>>
+LogitStrategyAtLambdaBatchWrapper(const Game &p_game,
+                                  const std::list<std::list<double>> &p_targetLambdas,
+                                  double p_firstStep, double p_maxAccel, int p_numThreads)
+{
+  LogitQREMixedStrategyProfile start(p_game);
+  std::list<std::list<std::shared_ptr<LogitQREMixedStrategyProfile>>> ret;
+  for (auto &run : LogitStrategySolveLambda(start, p_targetLambdas, 1.0, p_firstStep, p_maxAccel,
+                                            p_numThreads)) {
+    ret.emplace_back();
+    for (auto &qre : run) {
+      ret.back().push_back(std::make_shared<LogitQREMixedStrategyProfile>(qre));
+    }
+  }
+  return ret;
+}
+
+std::list<std::shared_ptr<LogitQREMixedStrategyProfile>> LogitStrategyEstimateBatchWrapper(
+    const std::list<std::shared_ptr<MixedStrategyProfile<double>>> &p_frequencies,
+    bool p_stopAtLocal, double p_firstStep, double p_maxAccel, int p_numThreads)
+{
+  std::list<MixedStrategyProfile<double>> frequencies;
+  for (const auto &profile : p_frequencies) {
+    frequencies.push_back(*profile);
+  }
+  std::list<std::shared_ptr<LogitQREMixedStrategyProfile>> ret;
+  for (auto &qre : LogitStrategyEstimate(frequencies, 1000000.0, 1.0, p_stopAtLocal, p_firstStep,
+                                         p_maxAccel, p_numThreads)) {
+    ret.push_back(std::make_shared<LogitQREMixedStrategyProfile>(qre));
+  }
+  return ret;
+}
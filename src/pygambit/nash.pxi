@@ -75,8 +75,10 @@ def _convert_mbpr(
     return ret
 
 
-def _enumpure_strategy_solve(game: Game) -> typing.List[MixedStrategyProfileRational]:
-    return _convert_mspr(EnumPureStrategySolve(game.game))
+def _enumpure_strategy_solve(
+        game: Game, threads: int = 1
+) -> typing.List[MixedStrategyProfileRational]:
+    return _convert_mspr(EnumPureStrategySolve(game.game, threads))
 
 
 def _enumpure_agent_solve(game: Game) -> typing.List[MixedBehaviorProfileRational]:
@@ -108,15 +110,15 @@ def _lcp_behavior_solve_rational(
 
 
 def _lcp_strategy_solve_double(
-        game: Game, stop_after: int, max_depth: int
+        game: Game, stop_after: int, max_depth: int, threads: int = 1
 ) -> typing.List[MixedStrategyProfileDouble]:
-    return _convert_mspd(LcpStrategySolveDouble(game.game, stop_after, max_depth))
+    return _convert_mspd(LcpStrategySolveDouble(game.game, stop_after, max_depth, threads))
 
 
 def _lcp_strategy_solve_rational(
-        game: Game, stop_after: int, max_depth: int
+        game: Game, stop_after: int, max_depth: int, threads: int = 1
 ) -> typing.List[MixedStrategyProfileRational]:
-    return _convert_mspr(LcpStrategySolveRational(game.game, stop_after, max_depth))
+    return _convert_mspr(LcpStrategySolveRational(game.game, stop_after, max_depth, threads))
 
 
 def _lp_behavior_solve_double(game: Game) -> typing.List[MixedBehaviorProfileDouble]:
@@ -183,15 +185,19 @@ def _gnm_strategy_solve(
 
 
 def _logit_strategy_solve(
-        game: Game, maxregret: float, first_step: float, max_accel: float,
+        game: Game, maxregret: float, first_step: float, max_accel: float, broyden: bool,
 ) -> typing.List[MixedStrategyProfileDouble]:
-    return _convert_mspd(LogitStrategySolveWrapper(game.game, maxregret, first_step, max_accel))
+    return _convert_mspd(
+        LogitStrategySolveWrapper(game.game, maxregret, first_step, max_accel, broyden)
+    )
 
 
 def _logit_behavior_solve(
-        game: Game, maxregret: float, first_step: float, max_accel: float,
+        game: Game, maxregret: float, first_step: float, max_accel: float, broyden: bool,
 ) -> typing.List[MixedBehaviorProfileDouble]:
-    return _convert_mbpd(LogitBehaviorSolveWrapper(game.game, maxregret, first_step, max_accel))
+    return _convert_mbpd(
+        LogitBehaviorSolveWrapper(game.game, maxregret, first_step, max_accel, broyden)
+    )
 
 
 @cython.cclass
@@ -240,29 +246,72 @@ class LogitQREMixedStrategyProfile:
         return profile
 
 
-def _logit_strategy_estimate(profile: MixedStrategyProfileDouble,
+def _logit_strategy_estimate(profile: typing.Union[MixedStrategyProfileDouble,
+                                                   typing.List[MixedStrategyProfileDouble]],
                              local_max: bool = False,
                              first_step: float = .03,
-                             max_accel: float = 1.1) -> LogitQREMixedStrategyProfile:
+                             max_accel: float = 1.1,
+                             threads: int = 1) -> typing.Union[
+                                 LogitQREMixedStrategyProfile,
+                                 typing.List[LogitQREMixedStrategyProfile]
+                             ]:
     """Estimate QRE corresponding to mixed strategy profile using
     maximum likelihood along the principal branch.
+
+    If `profile` is a list of profiles on the same game, the estimates are computed
+    independently, using up to `threads` threads (zero meaning one for each hardware
+    thread), and a list of the estimates is returned.
     """
-    ret = LogitQREMixedStrategyProfile(profile.game)
-    ret.thisptr = LogitStrategyEstimateWrapper(profile.profile, local_max, first_step, max_accel)
+    profiles = cython.declare(clist[shared_ptr[c_MixedStrategyProfileDouble]])
+    if isinstance(profile, MixedStrategyProfileDouble):
+        qre = LogitQREMixedStrategyProfile(profile.game)
+        qre.thisptr = LogitStrategyEstimateWrapper(
+            cython.cast(MixedStrategyProfileDouble, profile).profile,
+            local_max, first_step, max_accel
+        )
+        return qre
+    for p in profile:
+        profiles.push_back(cython.cast(MixedStrategyProfileDouble, p).profile)
+    ret = []
+    for estimate in LogitStrategyEstimateBatchWrapper(profiles, local_max,
+                                                      first_step, max_accel, threads):
+        qre = LogitQREMixedStrategyProfile()
+        qre.thisptr = estimate
+        ret.append(qre)
     return ret
 
 
 def _logit_strategy_lambda(game: Game,
-                           lam: typing.Union[float, typing.List[float]],
+                           lam: typing.Union[float, typing.List[float],
+                                             typing.List[typing.List[float]]],
                            first_step: float = .03,
-                           max_accel: float = 1.1) -> typing.List[LogitQREMixedStrategyProfile]:
+                           max_accel: float = 1.1,
+                           threads: int = 1) -> typing.Union[
+                               typing.List[LogitQREMixedStrategyProfile],
+                               typing.List[typing.List[LogitQREMixedStrategyProfile]]
+                           ]:
     """Compute the first QRE encountered along the principal branch of the strategic
     game corresponding to lambda value `lam`.
+
+    If `lam` is a list of lists of lambda values, the branch is traced independently
+    for each list, using up to `threads` threads (zero meaning one for each hardware
+    thread), and a list of the lists of QRE found is returned.
     """
     try:
         iter(lam)
     except TypeError:
         lam = [lam]
+    lam = list(lam)
+    if lam and all(isinstance(targets, (list, tuple)) for targets in lam):
+        ret = []
+        for run in LogitStrategyAtLambdaBatchWrapper(game.game, lam, first_step,
+                                                     max_accel, threads):
+            ret.append([])
+            for profile in run:
+                qre = LogitQREMixedStrategyProfile()
+                qre.thisptr = profile
+                ret[-1].append(qre)
+        return ret
     ret = []
     for profile in LogitStrategyAtLambdaWrapper(game.game, lam, first_step, max_accel):
         qre = LogitQREMixedStrategyProfile()
@@ -533,6 +533,7 @@ def logit_solve(
         maxregret: float = 1.0e-8,
         first_step: float = .03,
         max_accel: float = 1.1,
+        broyden: bool = False,
 ) -> NashComputationResult:
     """Compute Nash equilibria of a game using :ref:`the logit quantal response
     equilibrium correspondence <gambit-logit>`.
@@ -566,6 +567,13 @@ def logit_solve(
 
         .. versionadded:: 16.2.0
 
+    broyden : bool, default False
+        Whether to carry the factorization of the Jacobian between steps using
+        Broyden updates, evaluating it afresh only when the corrector
+        converges slowly.
+
+        .. versionadded:: 16.3.0
+
     Returns
     -------
     res : NashComputationResult
@@ -574,14 +582,16 @@ def logit_solve(
     if maxregret <= 0.0:
         raise ValueError("logit_solve(): maxregret argument must be positive")
     if not game.is_tree or use_strategic:
-        equilibria = libgbt._logit_strategy_solve(game, maxregret, first_step, max_accel)
+        equilibria = libgbt._logit_strategy_solve(game, maxregret, first_step, max_accel,
+                                                  broyden)
     else:
-        equilibria = libgbt._logit_behavior_solve(game, maxregret, first_step, max_accel)
+        equilibria = libgbt._logit_behavior_solve(game, maxregret, first_step, max_accel,
+                                                  broyden)
     return NashComputationResult(
         game=game,
         method="logit",
         rational=False,
         use_strategic=not game.is_tree or use_strategic,
         equilibria=equilibria,
-        parameters={"first_step": first_step, "max_accel": max_accel},
+        parameters={"first_step": first_step, "max_accel": max_accel, "broyden": broyden},
     )
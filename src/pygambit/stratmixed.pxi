@@ -274,8 +274,7 @@ class MixedStrategyProfile:
             raise ValueError(
                 "when setting a mixed strategy, must specify exactly one value per strategy"
             )
-        for s, v in zip(player.strategies, value):
-            self._setprob_strategy(s, v)
+        self._setprobs_player(player, value)
 
     def __setitem__(
             self,
@@ -563,6 +562,9 @@ class MixedStrategyProfileDouble(MixedStrategyProfile):
     def _setprob_strategy(self, strategy: Strategy, value) -> None:
         setitem_mspd_strategy(deref(self.profile), strategy.strategy, value)
 
+    def _setprobs_player(self, player: Player, value: typing.Any) -> None:
+        setitem_mspd_player(deref(self.profile), player.player, list(value))
+
     def _payoff(self, player: Player) -> float:
         return deref(self.profile).GetPayoff(player.player)
 
@@ -637,6 +639,15 @@ class MixedStrategyProfileRational(MixedStrategyProfile):
         setitem_mspr_strategy(deref(self.profile), strategy.strategy,
                               to_rational(str(value).encode("ascii")))
 
+    def _setprobs_player(self, player: Player, value: typing.Any) -> None:
+        probs = cython.declare(clist[c_Rational])
+        for v in value:
+            if not isinstance(v, (int, fractions.Fraction)):
+                raise TypeError("probability should be int or Fraction instance; received {}"
+                                .format(v.__class__.__name__))
+            probs.push_back(to_rational(str(v).encode("ascii")))
+        setitem_mspr_player(deref(self.profile), player.player, probs)
+
     def _payoff(self, player: Player) -> Rational:
         return rat_to_py(deref(self.profile).GetPayoff(player.player))
 
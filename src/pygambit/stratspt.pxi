@@ -255,10 +255,17 @@ class StrategySupportProfile:
 
 
 def _undominated_strategies_solve(
-        profile: StrategySupportProfile, strict: bool, external: bool
+        profile: StrategySupportProfile, strict: bool, external: bool, mixed: bool
 ) -> StrategySupportProfile:
     result = StrategySupportProfile(profile.game)
-    result.support.reset(
-        new c_StrategySupportProfile(deref(profile.support).Undominated(strict, external))
-    )
+    if mixed:
+        result.support.reset(
+            new c_StrategySupportProfile(
+                UndominatedMixed(deref(profile.support), strict, external)
+            )
+        )
+    else:
+        result.support.reset(
+            new c_StrategySupportProfile(deref(profile.support).Undominated(strict, external))
+        )
     return result
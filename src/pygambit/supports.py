@@ -27,10 +27,11 @@ import pygambit.gambit as libgbt
 def undominated_strategies_solve(
         profile: gbt.StrategySupportProfile,
         strict: bool = False,
-        external: bool = False
+        external: bool = False,
+        mixed: bool = False
 ) -> gbt.StrategySupportProfile:
     """Return a support profile including only the strategies in `profile` which are not dominated
-    by another pure strategy.
+    by another pure strategy, or, if `mixed` is specified, by a mixed strategy.
 
     This function performs only one round of elimination.
 
@@ -48,9 +49,16 @@ def undominated_strategies_solve(
         the support profile for that player.  If `True`, strategies which are dominated
         by another strategy not in the support profile are also eliminated.
 
+    mixed : bool, default False
+        If specified `True`, eliminate strategies which are dominated by a mixed strategy
+        over the player's other strategies, and not only by a pure strategy.  Each
+        strategy is tested by solving a linear program in exact rational arithmetic.
+
+        .. versionadded:: 16.3.0
+
     Returns
     -------
     StrategySupportProfile
         A new support profile containing only the strategies which are not dominated.
     """
-    return libgbt._undominated_strategies_solve(profile, strict, external)
+    return libgbt._undominated_strategies_solve(profile, strict, external, mixed)
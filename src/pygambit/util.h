@@ -27,6 +27,7 @@
 //
 
 #include <string>
+#include <list>
 #include <fstream>
 #include <sstream>
 #include "gambit.h"
@@ -102,6 +103,19 @@ void setitem(C &p_container, const X &p_index, const T &p_value)
   p_container[p_index] = p_value;
 }
 
+// Set the probabilities of the strategies of p_player in p_profile to p_probs
+template <class T>
+void setitem_player(MixedStrategyProfile<T> &p_profile, const GamePlayer &p_player,
+                    const std::list<T> &p_probs)
+{
+  Vector<T> probs(p_probs.size());
+  int st = 1;
+  for (const auto &prob : p_probs) {
+    probs[st++] = prob;
+  }
+  p_profile.SetStrategyProbs(p_player, probs);
+}
+
 // Convert the (C-style) string p_value to a Rational
 inline Rational to_rational(const char *p_value)
 {
@@ -0,0 +1,161 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2024, The Gambit Project (http://www.gambit-project.org)
+//
+// FILE: src/solvers/enumpure/enumpure.cc
+// Enumerate pure-strategy equilibrium profiles of games
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "gambit.h"
+#include "games/gametable.h"
+#include "solvers/enumpure/enumpure.h"
+
+namespace Gambit {
+namespace Nash {
+
+namespace {
+
+/// Approximate number of contingencies handed to a thread at a time
+const long EntriesPerChunk = 1L << 14;
+
+} // end anonymous namespace
+
+EnumPureStrategySolver::EnumPureStrategySolver(
+    std::shared_ptr<StrategyProfileRenderer<Rational>> p_onEquilibrium, int p_numThreads)
+  : StrategySolver<Rational>(p_onEquilibrium), m_numThreads(p_numThreads)
+{
+  if (m_numThreads < 0) {
+    throw ValueException("Number of threads must be non-negative");
+  }
+  if (m_numThreads == 0) {
+    m_numThreads = static_cast<int>(std::max(1U, std::thread::hardware_concurrency()));
+  }
+}
+
+List<MixedStrategyProfile<Rational>> EnumPureStrategySolver::Solve(const Game &p_game) const
+{
+  if (!p_game->IsPerfectRecall()) {
+    throw UndefinedException(
+        "Computing equilibria of games with imperfect recall is not supported.");
+  }
+  if (dynamic_cast<GameTableRep *>(p_game.operator->())) {
+    return SolveTable(p_game);
+  }
+  List<MixedStrategyProfile<Rational>> solutions;
+  for (StrategyProfileIterator citer(p_game); !citer.AtEnd(); citer++) {
+    if ((*citer)->IsNash()) {
+      MixedStrategyProfile<Rational> profile = (*citer)->ToMixedStrategyProfile();
+      m_onEquilibrium->Render(profile);
+      solutions.push_back(profile);
+    }
+  }
+  return solutions;
+}
+
+List<MixedStrategyProfile<Rational>>
+EnumPureStrategySolver::SolveTable(const Game &p_game) const
+{
+  // The index takes the ranks of the payoffs here, before any threads are started;
+  // the worker threads only search the index, and never touch the game's objects,
+  // whose reference counts are not thread-safe.  Equilibria are converted into
+  // profiles and rendered only on the calling thread.
+  const BestResponseIndex index(p_game);
+  const long sliceSize = index.NumContingencies() / index.NumSlices();
+  const long slicesPerChunk = std::max(1L, EntriesPerChunk / sliceSize);
+  const long numChunks = (index.NumSlices() + slicesPerChunk - 1) / slicesPerChunk;
+
+  std::vector<std::vector<long>> found(numChunks);
+  std::vector<bool> complete(numChunks, false);
+  std::atomic<long> nextChunk{0};
+  std::mutex mutex;
+  std::condition_variable chunkCompleted;
+
+  // Claim and search chunks until none remain.  Returns after searching at most
+  // one chunk if p_once is true, so the calling thread can report progress.
+  auto search = [&](bool p_once) {
+    for (long chunk = nextChunk++; chunk < numChunks; chunk = nextChunk++) {
+      std::vector<long> equilibria;
+      index.FindNashEquilibria(chunk * slicesPerChunk,
+                               std::min((chunk + 1) * slicesPerChunk, index.NumSlices()),
+                               equilibria);
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        found[chunk] = std::move(equilibria);
+        complete[chunk] = true;
+      }
+      chunkCompleted.notify_one();
+      if (p_once) {
+        return;
+      }
+    }
+  };
+
+  const int numThreads = static_cast<int>(std::min<long>(m_numThreads, numChunks));
+  std::vector<std::thread> workers;
+  for (int i = 1; i < numThreads; i++) {
+    workers.emplace_back(search, false);
+  }
+
+  List<MixedStrategyProfile<Rational>> solutions;
+  PureStrategyProfile contingency = p_game->NewPureStrategyProfile();
+  try {
+    for (long reported = 0; reported < numChunks;) {
+      if (nextChunk < numChunks) {
+        search(true);
+      }
+      std::vector<long> equilibria;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        chunkCompleted.wait(lock, [&]() { return complete[reported] || nextChunk < numChunks; });
+        if (!complete[reported]) {
+          continue;
+        }
+        equilibria = std::move(found[reported++]);
+      }
+      for (auto cont : equilibria) {
+        for (auto player : p_game->GetPlayers()) {
+          contingency->SetStrategy(
+              player->GetStrategy(index.GetStrategyNumber(player->GetNumber(), cont)));
+        }
+        MixedStrategyProfile<Rational> profile = contingency->ToMixedStrategyProfile();
+        m_onEquilibrium->Render(profile);
+        solutions.push_back(profile);
+      }
+    }
+  }
+  catch (...) {
+    // Stop the workers from claiming further chunks before abandoning them
+    nextChunk = numChunks;
+    for (auto &worker : workers) {
+      worker.join();
+    }
+    throw;
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+  return solutions;
+}
+
+} // end namespace Nash
+} // end namespace Gambit
@@ -32,38 +32,34 @@ namespace Nash {
 /// Enumerate pure-strategy Nash equilibria of a game.  By definition,
 /// pure-strategy equilibrium uses the strategic representation of a game.
 ///
+/// On strategic games, the contingencies are searched using a BestResponseIndex,
+/// in slices along the first player's strategies: the first player's best
+/// responses are found once per slice, and only those contingencies are checked
+/// for profitable deviations by the other players.  The slices are divided into
+/// chunks which idle threads take in turn; equilibria are reported in the same
+/// order as a serial search, as soon as all earlier chunks are complete.
+///
 class EnumPureStrategySolver : public StrategySolver<Rational> {
 public:
+  /// Construct a solver using p_numThreads threads on strategic games.
+  /// If p_numThreads is zero, one thread per hardware thread is used.
   explicit EnumPureStrategySolver(
-      std::shared_ptr<StrategyProfileRenderer<Rational>> p_onEquilibrium = nullptr)
-    : StrategySolver<Rational>(p_onEquilibrium)
-  {
-  }
+      std::shared_ptr<StrategyProfileRenderer<Rational>> p_onEquilibrium = nullptr,
+      int p_numThreads = 1);
   ~EnumPureStrategySolver() override = default;
 
   List<MixedStrategyProfile<Rational>> Solve(const Game &p_game) const override;
-};
 
-inline List<MixedStrategyProfile<Rational>> EnumPureStrategySolver::Solve(const Game &p_game) const
-{
-  if (!p_game->IsPerfectRecall()) {
-    throw UndefinedException(
-        "Computing equilibria of games with imperfect recall is not supported.");
-  }
-  List<MixedStrategyProfile<Rational>> solutions;
-  for (StrategyProfileIterator citer(p_game); !citer.AtEnd(); citer++) {
-    if ((*citer)->IsNash()) {
-      MixedStrategyProfile<Rational> profile = (*citer)->ToMixedStrategyProfile();
-      m_onEquilibrium->Render(profile);
-      solutions.push_back(profile);
-    }
-  }
-  return solutions;
-}
+private:
+  int m_numThreads;
+
+  List<MixedStrategyProfile<Rational>> SolveTable(const Game &p_game) const;
+};
 
-inline List<MixedStrategyProfile<Rational>> EnumPureStrategySolve(const Game &p_game)
+inline List<MixedStrategyProfile<Rational>> EnumPureStrategySolve(const Game &p_game,
+                                                                 int p_numThreads = 1)
 {
-  return EnumPureStrategySolver().Solve(p_game);
+  return EnumPureStrategySolver(nullptr, p_numThreads).Solve(p_game);
 }
 
 ///
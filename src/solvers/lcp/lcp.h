@@ -28,42 +28,64 @@
 namespace Gambit {
 
 namespace linalg {
+template <class T> class BFS;
 template <class T> class LHTableau;
 template <class T> class LemkeTableau;
 } // namespace linalg
 
 namespace Nash {
 
+///
+/// Find Nash equilibria of a two-player strategic game by following Lemke-Howson
+/// paths from the extraneous solution, and then from each equilibrium found
+/// along each of the other labels in turn.
+///
+/// The paths from an equilibrium are independent of each other, so they may be
+/// followed on several threads.  In that case the equilibria are reported in
+/// the order in which they are reached, which may vary from run to run, and
+/// when a recursion depth is specified an equilibrium may be reached at a
+/// different depth than in the single-threaded search.
+///
 template <class T> class NashLcpStrategySolver : public StrategySolver<T> {
 public:
+  /// Construct a solver following paths on p_numThreads threads.  If
+  /// p_numThreads is zero, one thread per hardware thread is used.
   NashLcpStrategySolver(int p_stopAfter, int p_maxDepth,
-                        std::shared_ptr<StrategyProfileRenderer<T>> p_onEquilibrium = nullptr)
-    : StrategySolver<T>(p_onEquilibrium), m_stopAfter(p_stopAfter), m_maxDepth(p_maxDepth)
-  {
-  }
+                        std::shared_ptr<StrategyProfileRenderer<T>> p_onEquilibrium = nullptr,
+                        int p_numThreads = 1);
   ~NashLcpStrategySolver() override = default;
 
   List<MixedStrategyProfile<T>> Solve(const Game &) const override;
 
 private:
-  int m_stopAfter, m_maxDepth;
+  int m_stopAfter, m_maxDepth, m_numThreads;
 
   class Solution;
 
-  bool OnBFS(const Game &, linalg::LHTableau<T> &, Solution &) const;
-  void AllLemke(const Game &, int j, linalg::LHTableau<T> &, Solution &, int) const;
+  // These are templates on the tableau, which is either an LHTableau<T>
+  // or, in floating-point arithmetic, a DenseLHTableau
+  template <class Tableau> void Search(const Game &, Tableau &, Solution &) const;
+  template <class Tableau> bool OnBFS(const Game &, Tableau &, Solution &) const;
+  bool AddEquilibrium(const Game &, const linalg::BFS<T> &, Solution &) const;
+  template <class Tableau> void AllLemke(const Game &, int j, Tableau &, Solution &, int) const;
+  template <class Tableau>
+  void AllLemkeConcurrent(const Game &, const Tableau &, Solution &) const;
 };
 
-inline List<MixedStrategyProfile<double>> LcpStrategySolveDouble(const Game &p_game,
-                                                                 int p_stopAfter, int p_maxDepth)
+inline List<MixedStrategyProfile<double>>
+LcpStrategySolveDouble(const Game &p_game, int p_stopAfter, int p_maxDepth, int p_numThreads = 1)
 {
-  return NashLcpStrategySolver<double>(p_stopAfter, p_maxDepth).Solve(p_game);
+  return NashLcpStrategySolver<double>(p_stopAfter, p_maxDepth, nullptr, p_numThreads)
+      .Solve(p_game);
 }
 
-inline List<MixedStrategyProfile<Rational>>
-LcpStrategySolveRational(const Game &p_game, int p_stopAfter, int p_maxDepth)
+inline List<MixedStrategyProfile<Rational>> LcpStrategySolveRational(const Game &p_game,
+                                                                     int p_stopAfter,
+                                                                     int p_maxDepth,
+                                                                     int p_numThreads = 1)
 {
-  return NashLcpStrategySolver<Rational>(p_stopAfter, p_maxDepth).Solve(p_game);
+  return NashLcpStrategySolver<Rational>(p_stopAfter, p_maxDepth, nullptr, p_numThreads)
+      .Solve(p_game);
 }
 
 template <class T> class NashLcpBehaviorSolver : public BehavSolver<T> {
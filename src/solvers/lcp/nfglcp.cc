@@ -21,9 +21,16 @@
 //
 
 #include <iostream>
+#include <condition_variable>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <unordered_set>
 
 #include "gambit.h"
 #include "solvers/linalg/lhtab.h"
+#include "solvers/linalg/lhdense.h"
 #include "solvers/lcp/lcp.h"
 
 namespace Gambit {
@@ -110,36 +117,90 @@ template <class T> Vector<T> Make_b2(const Game &p_game)
   return b2;
 }
 
+/// Hash of the (sorted) basic variables of a CBFS
+struct BasisHash {
+  size_t operator()(const std::vector<int> &p_basis) const
+  {
+    size_t seed = p_basis.size();
+    for (int label : p_basis) {
+      seed ^= std::hash<int>()(label) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+  }
+};
+
+/// True if the CBFS gives no weight to player 1's strategies, that is, if it
+/// is the extraneous solution
+template <class T> bool IsTrivial(const linalg::BFS<T> &p_bfs, int p_n1)
+{
+  T sum = (T)0;
+  for (int j = 1; j <= p_n1; j++) {
+    if (p_bfs.count(j)) {
+      sum += p_bfs[j];
+    }
+  }
+  return sum == (T)0;
+}
+
 } // end anonymous namespace
 
+template <class T>
+NashLcpStrategySolver<T>::NashLcpStrategySolver(
+    int p_stopAfter, int p_maxDepth,
+    std::shared_ptr<StrategyProfileRenderer<T>> p_onEquilibrium, int p_numThreads)
+  : StrategySolver<T>(p_onEquilibrium), m_stopAfter(p_stopAfter), m_maxDepth(p_maxDepth),
+    m_numThreads(p_numThreads)
+{
+  if (m_numThreads < 0) {
+    throw ValueException("Number of threads must be non-negative");
+  }
+  if (m_numThreads == 0) {
+    m_numThreads = static_cast<int>(std::max(1U, std::thread::hardware_concurrency()));
+  }
+}
+
 template <class T> class NashLcpStrategySolver<T>::Solution {
 public:
-  List<Gambit::linalg::BFS<T>> m_bfsList;
+  std::unordered_set<std::vector<int>, BasisHash> m_visited;
   List<MixedStrategyProfile<T>> m_equilibria;
 
-  bool Contains(const Gambit::linalg::BFS<T> &p_bfs) const { return m_bfsList.Contains(p_bfs); }
-  void push_back(const Gambit::linalg::BFS<T> &p_bfs) { m_bfsList.push_back(p_bfs); }
+  /// Records the CBFS as visited; returns false if it had been visited already
+  bool Insert(const Gambit::linalg::BFS<T> &p_bfs)
+  {
+    return m_visited.insert(p_bfs.GetBasis()).second;
+  }
 
   int EquilibriumCount() const { return m_equilibria.size(); }
 };
 
 //
 // Function called when a CBFS is encountered.
-// If it is not already in the list p_list, it is added.
-// The corresponding equilibrium is computed and output.
-// Returns 'true' if the CBFS is new; 'false' if it already appears in the
-// list.
+// If it has not already been visited, it is recorded as visited, and
+// the corresponding equilibrium is computed and output.
+// Returns 'true' if the CBFS is new; 'false' if it has already been
+// visited, or is the extraneous solution.
 //
 template <class T>
-bool NashLcpStrategySolver<T>::OnBFS(const Game &p_game, linalg::LHTableau<T> &p_tableau,
+template <class Tableau>
+bool NashLcpStrategySolver<T>::OnBFS(const Game &p_game, Tableau &p_tableau,
                                      Solution &p_solution) const
 {
   Gambit::linalg::BFS<T> cbfs(p_tableau.GetBFS());
-  if (p_solution.Contains(cbfs)) {
+  if (!p_solution.Insert(cbfs)) {
     return false;
   }
-  p_solution.push_back(cbfs);
+  return AddEquilibrium(p_game, cbfs, p_solution);
+}
 
+//
+// Computes and outputs the equilibrium corresponding to a new CBFS.
+// Returns 'false' if the CBFS is the extraneous solution.
+//
+template <class T>
+bool NashLcpStrategySolver<T>::AddEquilibrium(const Game &p_game,
+                                              const linalg::BFS<T> &cbfs,
+                                              Solution &p_solution) const
+{
   MixedStrategyProfile<T> profile(p_game->NewMixedStrategyProfile(static_cast<T>(0.0)));
   int n1 = p_game->GetPlayer(1)->GetStrategies().size();
   int n2 = p_game->GetPlayer(2)->GetStrategies().size();
@@ -200,7 +261,8 @@ bool NashLcpStrategySolver<T>::OnBFS(const Game &p_game, linalg::LHTableau<T> &p
 // all possible paths, adding any new equilibria to the List.
 //
 template <class T>
-void NashLcpStrategySolver<T>::AllLemke(const Game &p_game, int j, linalg::LHTableau<T> &B,
+template <class Tableau>
+void NashLcpStrategySolver<T>::AllLemke(const Game &p_game, int j, Tableau &B,
                                         Solution &p_solution, int depth) const
 {
   if (m_maxDepth != 0 && depth > m_maxDepth) {
@@ -215,13 +277,162 @@ void NashLcpStrategySolver<T>::AllLemke(const Game &p_game, int j, linalg::LHTab
 
   for (int i = B.MinCol(); i <= B.MaxCol(); i++) {
     if (i != j) {
-      linalg::LHTableau<T> Bcopy(B);
+      Tableau Bcopy(B);
       Bcopy.LemkePath(i);
       AllLemke(p_game, i, Bcopy, p_solution, depth + 1);
     }
   }
 }
 
+//
+// AllLemkeConcurrent visits the same equilibria as AllLemke, with the
+// paths followed on m_numThreads worker threads.  Each path to be followed
+// is a task, given by the CBFS it starts from and the label to drop; the
+// tasks are held on a stack shared by the workers.  A tableau is shared
+// with other threads only after its pivoting is complete, so copies made
+// from it remain valid; each keeps its parent alive, as the decomposition
+// of a copied tableau may refer to that of the original.
+//
+// The workers only pivot tableaus and record the bases visited; the
+// equilibria are computed and output on the calling thread, as the game
+// may not be accessed from other threads.
+//
+template <class T>
+template <class Tableau>
+void NashLcpStrategySolver<T>::AllLemkeConcurrent(const Game &p_game, const Tableau &p_tableau,
+                                                  Solution &p_solution) const
+{
+  struct Node {
+    std::shared_ptr<const Node> m_parent;
+    Tableau m_tableau;
+
+    Node(const std::shared_ptr<const Node> &p_parent, const Tableau &p_tableau)
+      : m_parent(p_parent), m_tableau(p_tableau)
+    {
+    }
+  };
+  struct Task {
+    std::shared_ptr<const Node> m_node;
+    int m_label, m_depth;
+  };
+
+  const int n1 = p_game->GetPlayer(1)->GetStrategies().size();
+  std::mutex mutex;
+  std::condition_variable cond;
+  std::vector<Task> tasks;
+  std::list<linalg::BFS<T>> found;
+  int active = 0;
+  bool stop = false;
+  std::exception_ptr error;
+
+  // Adds the tasks of following each path from the node, other than the
+  // one along which it was reached; called with the mutex held
+  auto branch = [&](const std::shared_ptr<const Node> &p_node, int p_label, int p_depth) {
+    if (m_maxDepth != 0 && p_depth > m_maxDepth) {
+      return;
+    }
+    for (int i = p_node->m_tableau.MaxCol(); i >= p_node->m_tableau.MinCol(); i--) {
+      if (i != p_label) {
+        tasks.push_back({p_node, i, p_depth});
+      }
+    }
+  };
+
+  auto worker = [&]() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+      cond.wait(lock, [&]() { return stop || !tasks.empty() || active == 0; });
+      if (stop || tasks.empty()) {
+        break;
+      }
+      Task task = std::move(tasks.back());
+      tasks.pop_back();
+      active++;
+      lock.unlock();
+      try {
+        auto node = std::make_shared<Node>(task.m_node, task.m_node->m_tableau);
+        node->m_tableau.LemkePath(task.m_label);
+        linalg::BFS<T> cbfs(node->m_tableau.GetBFS());
+        lock.lock();
+        if (p_solution.Insert(cbfs) && !IsTrivial(cbfs, n1)) {
+          found.push_back(cbfs);
+          branch(node, task.m_label, task.m_depth + 1);
+        }
+      }
+      catch (...) {
+        if (!lock.owns_lock()) {
+          lock.lock();
+        }
+        if (!error) {
+          error = std::current_exception();
+        }
+        stop = true;
+      }
+      active--;
+      cond.notify_all();
+    }
+  };
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    branch(std::make_shared<Node>(nullptr, p_tableau), 0, 1);
+  }
+  std::vector<std::thread> threads;
+  for (int i = 0; i < m_numThreads; i++) {
+    threads.emplace_back(worker);
+  }
+
+  auto finish = [&]() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stop = true;
+    }
+    cond.notify_all();
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  };
+
+  try {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+      cond.wait(lock, [&]() { return stop || !found.empty() || (tasks.empty() && active == 0); });
+      if (found.empty()) {
+        break;
+      }
+      linalg::BFS<T> cbfs(found.front());
+      found.pop_front();
+      lock.unlock();
+      AddEquilibrium(p_game, cbfs, p_solution);
+      lock.lock();
+    }
+  }
+  catch (...) {
+    finish();
+    throw;
+  }
+  finish();
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+template <class T>
+template <class Tableau>
+void NashLcpStrategySolver<T>::Search(const Game &p_game, Tableau &B, Solution &p_solution) const
+{
+  if (m_stopAfter != 1 && m_numThreads > 1) {
+    AllLemkeConcurrent(p_game, B, p_solution);
+  }
+  else if (m_stopAfter != 1) {
+    AllLemke(p_game, 0, B, p_solution, 0);
+  }
+  else {
+    B.LemkePath(1);
+    OnBFS(p_game, B, p_solution);
+  }
+}
+
 template <class T>
 List<MixedStrategyProfile<T>> NashLcpStrategySolver<T>::Solve(const Game &p_game) const
 {
@@ -239,15 +450,16 @@ List<MixedStrategyProfile<T>> NashLcpStrategySolver<T>::Solve(const Game &p_game
     Vector<T> b1 = Make_b1<T>(p_game);
     Matrix<T> A2 = Make_A2<T>(p_game);
     Vector<T> b2 = Make_b2<T>(p_game);
-    linalg::LHTableau<T> B(A1, A2, b1, b2);
-
-    if (m_stopAfter != 1) {
-      AllLemke(p_game, 0, B, solution, 0);
-    }
-    else {
-      B.LemkePath(1);
-      OnBFS(p_game, B, solution);
+    // In floating-point arithmetic, a dense tableau is used if it fits
+    if constexpr (std::is_same<T, double>::value) {
+      if (linalg::DenseLHTableau::IsDense(A1.NumRows(), A2.NumRows())) {
+        linalg::DenseLHTableau B(A1, A2, b1, b2);
+        Search(p_game, B, solution);
+        return solution.m_equilibria;
+      }
     }
+    linalg::LHTableau<T> B(A1, A2, b1, b2);
+    Search(p_game, B, solution);
   }
   catch (EquilibriumLimitReached &) {
     // This pseudo-exception requires no additional action;
@@ -58,7 +58,9 @@ private:
   double Value(const Vector<double> &) const override;
   bool Gradient(const Vector<double> &, Vector<double> &) const override;
 
-  double LiapDerivValue(const MixedStrategyProfile<double> &, const GameStrategy &) const;
+  double LiapDerivValue(const MixedStrategyProfile<double> &, const Vector<double> &,
+                        const PVector<double> &, const Matrix<double> &,
+                        const GameStrategy &) const;
 };
 
 inline double sum_player_probs(const MixedStrategyProfile<double> &p_profile,
@@ -76,10 +78,13 @@ double StrategicLyapunovFunction::Value(const Vector<double> &v) const
   double value = 0;
   // Liapunov function proper - should be replaced with call to profile once
   // the penalty is removed from that implementation.
+  auto payoffs = m_profile.GetPayoffs();
+  auto values = m_profile.GetStrategyValues();
   for (auto player : m_profile.GetGame()->GetPlayers()) {
     for (auto strategy : player->GetStrategies()) {
-      value += sqr(
-          std::max(m_scale * (m_profile.GetPayoff(strategy) - m_profile.GetPayoff(player)), 0.0));
+      value += sqr(std::max(m_scale * (values(player->GetNumber(), strategy->GetNumber()) -
+                                       payoffs[player->GetNumber()]),
+                            0.0));
     }
   }
   // Penalty function for non-negativity constraint for each strategy
@@ -96,19 +101,34 @@ double StrategicLyapunovFunction::Value(const Vector<double> &v) const
 }
 
 double StrategicLyapunovFunction::LiapDerivValue(const MixedStrategyProfile<double> &p_profile,
+                                                 const Vector<double> &p_payoffs,
+                                                 const PVector<double> &p_values,
+                                                 const Matrix<double> &p_valueDerivs,
                                                  const GameStrategy &p_wrt_strategy) const
 {
   double deriv = 0.0;
   for (auto player : m_game->GetPlayers()) {
+    // The derivative of the player's payoff with respect to the probability of
+    // an opponent's strategy is the mean of the derivatives of their strategy values
+    double payoffDeriv = 0.0;
+    if (player == p_wrt_strategy->GetPlayer()) {
+      payoffDeriv = p_values(player->GetNumber(), p_wrt_strategy->GetNumber());
+    }
+    else {
+      for (auto strategy : player->GetStrategies()) {
+        payoffDeriv += p_profile[strategy] *
+                       p_valueDerivs(strategy->GetId(), p_wrt_strategy->GetId());
+      }
+    }
     for (auto strategy : player->GetStrategies()) {
-      double loss = sqr(m_scale) * (p_profile.GetPayoff(strategy) - p_profile.GetPayoff(player));
+      double loss =
+          sqr(m_scale) * (p_values(player->GetNumber(), strategy->GetNumber()) -
+                          p_payoffs[player->GetNumber()]);
       if (loss <= 0.0) {
         continue;
       }
-      deriv -= loss * p_profile.GetPayoffDeriv(player->GetNumber(), p_wrt_strategy);
-      if (player != p_wrt_strategy->GetPlayer()) {
-        deriv += loss * p_profile.GetPayoffDeriv(player->GetNumber(), strategy, p_wrt_strategy);
-      }
+      deriv -= loss * payoffDeriv;
+      deriv += loss * p_valueDerivs(strategy->GetId(), p_wrt_strategy->GetId());
     }
   }
   // Penalty function for non-negativity constraint for each strategy
@@ -121,10 +141,13 @@ double StrategicLyapunovFunction::LiapDerivValue(const MixedStrategyProfile<doub
 bool StrategicLyapunovFunction::Gradient(const Vector<double> &v, Vector<double> &d) const
 {
   m_profile = v;
+  auto payoffs = m_profile.GetPayoffs();
+  auto values = m_profile.GetStrategyValues();
+  auto valueDerivs = m_profile.GetStrategyValueDerivs();
   auto element = d.begin();
   for (auto player : m_game->GetPlayers()) {
     for (auto strategy : player->GetStrategies()) {
-      *element = LiapDerivValue(m_profile, strategy);
+      *element = LiapDerivValue(m_profile, payoffs, values, valueDerivs, strategy);
       ++element;
     }
   }
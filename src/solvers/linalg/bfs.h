@@ -25,6 +25,7 @@
 
 #include "gambit.h"
 #include <map>
+#include <vector>
 
 namespace Gambit {
 
@@ -56,6 +57,18 @@ public:
   }
   bool operator!=(const BFS &M) const { return !(*this == M); }
 
+  /// Returns the basic variables in increasing order; two BFS's are equal
+  /// exactly when these are the same
+  std::vector<int> GetBasis() const
+  {
+    std::vector<int> basis;
+    basis.reserve(m_map.size());
+    for (const auto &entry : m_map) {
+      basis.push_back(entry.first);
+    }
+    return basis;
+  }
+
   // Provide map-like operations
   int count(int key) const { return (m_map.count(key) > 0); }
 
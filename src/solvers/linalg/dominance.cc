@@ -0,0 +1,218 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2024, The Gambit Project (http://www.gambit-project.org)
+//
+// FILE: src/solvers/linalg/dominance.cc
+// Elimination of strategies dominated by mixed strategies
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#include <algorithm>
+
+#include "dominance.h"
+#include "lpsolve.h"
+
+namespace Gambit {
+
+template <class T>
+MixedDominance<T>::MixedDominance(const StrategySupportProfile &p_support, bool p_strict,
+                                  bool p_external)
+  : m_support(p_support), m_strict(p_strict), m_external(p_external),
+    m_players(p_support.GetGame()->NumPlayers())
+{
+  // The payoffs are read once, over the contingencies of the initial support;
+  // later rounds select the contingencies which remain.
+  for (const auto &player : m_support.GetPlayers()) {
+    PlayerData &data = m_players[player->GetNumber()];
+    for (const auto &strategy :
+         (m_external) ? player->GetStrategies() : m_support.GetStrategies(player)) {
+      data.m_strategies.push_back(strategy);
+    }
+    data.m_payoffs.resize(data.m_strategies.size());
+    data.m_witness.resize(data.m_strategies.size());
+    for (StrategyProfileIterator iter(m_support, m_support.GetStrategies(player).front());
+         !iter.AtEnd(); iter++) {
+      PureStrategyProfile profile = *iter;
+      Array<int> contingency(m_support.NumPlayers());
+      for (int pl = 1; pl <= m_support.NumPlayers(); pl++) {
+        contingency[pl] = profile->GetStrategy(pl)->GetNumber();
+      }
+      data.m_contingencies.push_back(contingency);
+      for (size_t st = 0; st < data.m_strategies.size(); st++) {
+        profile->SetStrategy(data.m_strategies[st]);
+        data.m_payoffs[st].push_back(static_cast<T>(profile->GetPayoff(player)));
+      }
+    }
+  }
+}
+
+//
+// Strategy t is dominated exactly when there is no belief p over the
+// remaining contingencies against which it is a best response among the
+// dominators s, that is, when the system
+//    sum_c p_c (u(s, c) - u(t, c)) <= 0   for each dominator s != t,
+//    p >= 0
+// has no solution with sum_c p_c = 1 (strict dominance) or with
+// p_c >= 1 for all c (weak dominance).  For the latter the belief is
+// written as p = 1 + q with q >= 0, which moves the constant to the
+// right-hand side so that LPSolve's nonnegativity constraints suffice.
+//
+template <class T>
+bool MixedDominance<T>::IsDominated(PlayerData &p_data, size_t p_strategy,
+                                    const std::vector<size_t> &p_active,
+                                    const std::vector<bool> &p_isActive,
+                                    const std::vector<size_t> &p_dominators)
+{
+  std::vector<size_t> &witness = p_data.m_witness[p_strategy];
+  if (!witness.empty() && std::all_of(witness.begin(), witness.end(),
+                                      [&p_isActive](size_t c) { return p_isActive[c]; })) {
+    return false;
+  }
+
+  std::vector<size_t> rivals;
+  std::copy_if(p_dominators.begin(), p_dominators.end(), std::back_inserter(rivals),
+               [p_strategy](size_t s) { return s != p_strategy; });
+  if (rivals.empty()) {
+    witness.clear();
+    return false;
+  }
+
+  const std::vector<T> &payoffs = p_data.m_payoffs[p_strategy];
+  const int rows = rivals.size() + ((m_strict) ? 1 : 0);
+  const int cols = p_active.size();
+  Matrix<T> A(1, rows, 1, cols);
+  Vector<T> b(1, rows), c(1, cols);
+  b = T(0);
+  c = T(0);
+  for (int i = 1; i <= static_cast<int>(rivals.size()); i++) {
+    const std::vector<T> &rival = p_data.m_payoffs[rivals[i - 1]];
+    for (int j = 1; j <= cols; j++) {
+      A(i, j) = rival[p_active[j - 1]] - payoffs[p_active[j - 1]];
+      if (!m_strict) {
+        b[i] -= A(i, j);
+      }
+    }
+  }
+  if (m_strict) {
+    for (int j = 1; j <= cols; j++) {
+      A(rows, j) = T(1);
+    }
+    b[rows] = T(1);
+  }
+
+  m_numSolved++;
+  linalg::LPSolve<T> lp(A, b, c, (m_strict) ? 1 : 0);
+  witness.clear();
+  if (!lp.IsFeasible()) {
+    return true;
+  }
+  if (!m_strict) {
+    witness = p_active;
+    return false;
+  }
+  const linalg::BFS<T> &bfs = lp.OptimumBFS();
+  for (int j = 1; j <= cols; j++) {
+    if (bfs.count(j) && bfs[j] > T(0)) {
+      witness.push_back(p_active[j - 1]);
+    }
+  }
+  if (witness.empty()) {
+    // Not expected from a feasible solution; fall back to the whole
+    // support so the witness is checked conservatively next round.
+    witness = p_active;
+  }
+  return false;
+}
+
+template <class T> bool MixedDominance<T>::Eliminate()
+{
+  // Membership of each strategy in the current support, by strategy number
+  Array<std::vector<bool>> contains(m_support.NumPlayers());
+  for (const auto &player : m_support.GetPlayers()) {
+    std::vector<bool> &member = contains[player->GetNumber()];
+    member.assign(player->NumStrategies() + 1, false);
+    for (const auto &strategy : m_support.GetStrategies(player)) {
+      member[strategy->GetNumber()] = true;
+    }
+  }
+
+  StrategySupportProfile newSupport(m_support);
+  bool removed = false;
+  for (int pl = 1; pl <= m_support.NumPlayers(); pl++) {
+    PlayerData &data = m_players[pl];
+    std::vector<size_t> active;
+    std::vector<bool> isActive(data.m_contingencies.size(), false);
+    for (size_t c = 0; c < data.m_contingencies.size(); c++) {
+      const Array<int> &contingency = data.m_contingencies[c];
+      bool remains = true;
+      for (int opp = 1; remains && opp <= m_support.NumPlayers(); opp++) {
+        remains = (opp == pl || contains[opp][contingency[opp]]);
+      }
+      if (remains) {
+        active.push_back(c);
+        isActive[c] = true;
+      }
+    }
+
+    std::vector<size_t> dominators;
+    for (size_t st = 0; st < data.m_strategies.size(); st++) {
+      if (m_external || contains[pl][data.m_strategies[st]->GetNumber()]) {
+        dominators.push_back(st);
+      }
+    }
+    for (size_t st = 0; st < data.m_strategies.size(); st++) {
+      if (contains[pl][data.m_strategies[st]->GetNumber()] &&
+          IsDominated(data, st, active, isActive, dominators)) {
+        removed = newSupport.RemoveStrategy(data.m_strategies[st]) || removed;
+      }
+    }
+  }
+  m_support = newSupport;
+  return removed;
+}
+
+template <class T>
+StrategySupportProfile UndominatedMixed(const StrategySupportProfile &p_support, bool p_strict,
+                                        bool p_external)
+{
+  MixedDominance<T> dominance(p_support, p_strict, p_external);
+  dominance.Eliminate();
+  return dominance.GetSupport();
+}
+
+template <class T>
+StrategySupportProfile IteratedUndominatedMixed(const StrategySupportProfile &p_support,
+                                                bool p_strict)
+{
+  MixedDominance<T> dominance(p_support, p_strict);
+  while (dominance.Eliminate())
+    ;
+  return dominance.GetSupport();
+}
+
+template class MixedDominance<double>;
+template class MixedDominance<Rational>;
+
+template StrategySupportProfile UndominatedMixed<double>(const StrategySupportProfile &, bool,
+                                                         bool);
+template StrategySupportProfile UndominatedMixed<Rational>(const StrategySupportProfile &, bool,
+                                                           bool);
+template StrategySupportProfile IteratedUndominatedMixed<double>(const StrategySupportProfile &,
+                                                                 bool);
+template StrategySupportProfile IteratedUndominatedMixed<Rational>(const StrategySupportProfile &,
+                                                                   bool);
+
+} // namespace Gambit
@@ -0,0 +1,99 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2024, The Gambit Project (http://www.gambit-project.org)
+//
+// FILE: src/solvers/linalg/dominance.h
+// Elimination of strategies dominated by mixed strategies
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#ifndef LINALG_DOMINANCE_H
+#define LINALG_DOMINANCE_H
+
+#include "gambit.h"
+
+namespace Gambit {
+
+///
+/// This class eliminates strategies which are dominated by a mixed strategy
+/// over the player's other strategies.  A strategy is strictly dominated
+/// exactly when it is not a best response to any belief over the contingencies
+/// of the other players in the support, and weakly dominated exactly when it
+/// is not a best response to any belief which puts positive probability on
+/// every contingency.  Each test is posed as the feasibility of such a belief,
+/// a linear program with one constraint for each alternative strategy, which
+/// is solved by LPSolve.
+///
+/// The belief found for each surviving strategy is kept as a witness.  In the
+/// next round of an iterated elimination the linear program is solved again
+/// only if the strategies removed in the meantime invalidate the witness:
+/// for strict dominance, if the belief put weight on a contingency which has
+/// been removed; for weak dominance, if any contingency has been removed.
+///
+template <class T> class MixedDominance {
+public:
+  /// Set up the elimination on the support.  If p_external is true, strategies
+  /// may be dominated by mixtures including strategies not in the support.
+  MixedDominance(const StrategySupportProfile &p_support, bool p_strict,
+                 bool p_external = false);
+  ~MixedDominance() = default;
+
+  /// Eliminate one round of dominated strategies, for all players
+  /// simultaneously.  Returns true if any strategy was removed.
+  bool Eliminate();
+
+  /// Returns the support remaining after the rounds of elimination so far
+  const StrategySupportProfile &GetSupport() const { return m_support; }
+  /// Returns the number of linear programs solved so far
+  int NumSolved() const { return m_numSolved; }
+
+private:
+  struct PlayerData {
+    /// The player's strategies which may dominate
+    std::vector<GameStrategy> m_strategies;
+    /// Strategy numbers of the other players in each contingency
+    std::vector<Array<int>> m_contingencies;
+    /// Payoffs to the player, indexed by strategy then contingency
+    std::vector<std::vector<T>> m_payoffs;
+    /// For each strategy found not to be dominated, the contingencies
+    /// on which its witness belief puts positive probability
+    std::vector<std::vector<size_t>> m_witness;
+  };
+
+  StrategySupportProfile m_support;
+  bool m_strict, m_external;
+  Array<PlayerData> m_players;
+  int m_numSolved{0};
+
+  bool IsDominated(PlayerData &, size_t p_strategy, const std::vector<size_t> &p_active,
+                   const std::vector<bool> &p_isActive, const std::vector<size_t> &p_dominators);
+};
+
+/// Returns a copy of the support with the strategies dominated by a mixed
+/// strategy eliminated (one round)
+template <class T>
+StrategySupportProfile UndominatedMixed(const StrategySupportProfile &p_support, bool p_strict,
+                                        bool p_external = false);
+
+/// Returns the support remaining after iterated elimination of strategies
+/// dominated by a mixed strategy
+template <class T>
+StrategySupportProfile IteratedUndominatedMixed(const StrategySupportProfile &p_support,
+                                                bool p_strict);
+
+} // namespace Gambit
+
+#endif // LINALG_DOMINANCE_H
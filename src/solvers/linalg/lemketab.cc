@@ -26,6 +26,93 @@ namespace Gambit {
 
 namespace linalg {
 
+namespace {
+
+//
+// Among the rows in p_best, keeps those at which the ratio of p_col to
+// p_incol is largest (or smallest, if p_minimize is true).  The entries of
+// p_incol in these rows are positive, so the ratios are compared by
+// cross-multiplying.
+//
+void SelectRatio(Array<int> &p_best, const Vector<Integer> &p_col,
+                 const Vector<Integer> &p_incol, bool p_minimize)
+{
+  int best = p_best[1];
+  for (int i = 2; i <= p_best.Length(); i++) {
+    Integer lhs = p_col[p_best[i]] * p_incol[best];
+    Integer rhs = p_col[best] * p_incol[p_best[i]];
+    if ((p_minimize) ? lhs < rhs : lhs > rhs) {
+      best = p_best[i];
+    }
+  }
+  for (int i = p_best.Length(); i >= 1; i--) {
+    if (p_col[p_best[i]] * p_incol[best] != p_col[best] * p_incol[p_best[i]]) {
+      p_best.Remove(i);
+    }
+  }
+}
+
+//
+// Breaks ties among the candidate rows p_best as LemkeTableau<T>::ExitIndex()
+// and SF_ExitIndex() do, by the ratios of the basis vector and then of each
+// slack column in turn to the entering column.  All of these are taken from
+// the integer tableau; within a row, each is scaled by the same positive
+// factor, and the scale of a column is common to all rows.
+//
+int BreakTies(const LemkeTableau<Rational> &p_tableau, Array<int> &p_best,
+              const Vector<Integer> &p_incol, bool p_minimize)
+{
+  Vector<Integer> col(p_tableau.MinRow(), p_tableau.MaxRow());
+  p_tableau.IntegerBasisVector(col);
+  for (int c = p_tableau.MinRow() - 1; p_best.Length() > 1; c++) {
+    if (c > p_tableau.MaxRow()) {
+      throw LemkeTableau<Rational>::BadExitIndex();
+    }
+    if (c >= p_tableau.MinRow()) {
+      p_tableau.IntegerColumn(-c, col);
+    }
+    SelectRatio(p_best, col, p_incol, p_minimize);
+  }
+  return p_best[1];
+}
+
+} // end anonymous namespace
+
+template <> int LemkeTableau<Rational>::SF_ExitIndex(int inlabel)
+{
+  Vector<Integer> incol(MinRow(), MaxRow());
+  IntegerColumn(inlabel, incol);
+  Array<int> BestSet;
+  for (int i = MinRow(); i <= MaxRow(); i++) {
+    if (incol[i] > 0) {
+      BestSet.push_back(i);
+    }
+  }
+  if (BestSet.Length() == 0) {
+    return 0;
+  }
+  return BreakTies(*this, BestSet, incol, true);
+}
+
+template <> int LemkeTableau<Rational>::ExitIndex(int inlabel)
+{
+  Vector<Integer> incol(MinRow(), MaxRow());
+  IntegerColumn(inlabel, incol);
+  Array<int> BestSet;
+  for (int i = MinRow(); i <= MaxRow(); i++) {
+    if (incol[i] > 0) {
+      BestSet.push_back(i);
+    }
+  }
+  if (BestSet.Length() == 0) {
+    if (incol[Find(0)] == 0) {
+      return Find(0);
+    }
+    throw BadExitIndex();
+  }
+  return BreakTies(*this, BestSet, incol, false);
+}
+
 template class LemkeTableau<double>;
 template class LemkeTableau<Rational>;
 
@@ -55,6 +55,10 @@ public:
   int LemkePath(int dup); // follow a path of ACBFS's from one CBFS to another
 };
 
+// In exact arithmetic, the ratio tests are done on the integer tableau
+template <> int LemkeTableau<Rational>::SF_ExitIndex(int);
+template <> int LemkeTableau<Rational>::ExitIndex(int);
+
 } // namespace linalg
 } // end namespace Gambit
 
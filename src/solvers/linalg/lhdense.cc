@@ -0,0 +1,212 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2024, The Gambit Project (http://www.gambit-project.org)
+//
+// FILE: src/solvers/linalg/lhdense.cc
+// Dense tableau for the Lemke-Howson algorithm in floating-point arithmetic
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#include <algorithm>
+
+#include "lhdense.h"
+#include "btableau.h"
+
+namespace Gambit {
+namespace linalg {
+
+//---------------------------------------------------------------------------
+//                     DenseLHTableau::System
+//---------------------------------------------------------------------------
+
+DenseLHTableau::System::System(const Matrix<double> &A, const Vector<double> &b)
+  : m_minRow(A.MinRow()), m_maxRow(A.MaxRow()), m_minCol(A.MinCol()), m_maxCol(A.MaxCol()),
+    m_width(A.NumColumns() + A.NumRows() + 1),
+    m_data(static_cast<size_t>(A.NumRows()) * m_width, 0.0), m_basis(A.NumRows()),
+    m_row(A.NumColumns() + A.NumRows(), -1)
+{
+  // The initial basis consists of the slack variables
+  for (int i = m_minRow; i <= m_maxRow; i++) {
+    double *row = &m_data[static_cast<size_t>(i - m_minRow) * m_width];
+    for (int j = m_minCol; j <= m_maxCol; j++) {
+      row[j - m_minCol] = A(i, j);
+    }
+    row[Column(-i)] = 1.0;
+    row[m_width - 1] = b[i];
+    m_basis[i - m_minRow] = -i;
+    m_row[Column(-i)] = i;
+  }
+}
+
+//
+// The choice of the row to leave is that of LemkeTableau<T>::ExitIndex,
+// the lexicographic rule specified by Eaves, which is guaranteed not to
+// cycle even if the problem is degenerate.  The candidate rows are those
+// with a positive entry in the entering column; ties in the ratio of the
+// right-hand side to that entry are broken by the ratios of each of the
+// slack columns in turn.
+//
+int DenseLHTableau::System::ExitIndex(int p_inlabel) const
+{
+  double eps1, eps2;
+  epsilon(eps1, 5);
+  epsilon(eps2);
+
+  const int incol = Column(p_inlabel);
+  std::vector<int> best;
+  for (int i = m_minRow; i <= m_maxRow; i++) {
+    if (Entry(i, incol) > eps2) {
+      best.push_back(i);
+    }
+  }
+  if (best.empty()) {
+    throw BadExitIndex();
+  }
+
+  for (int c = m_minRow - 1; best.size() > 1; c++) {
+    if (c > m_maxRow) {
+      throw BadExitIndex();
+    }
+    const int col = (c >= m_minRow) ? Column(-c) : m_width - 1;
+    double tempmax = Entry(best.front(), col) / Entry(best.front(), incol);
+    for (auto i : best) {
+      tempmax = std::max(tempmax, Entry(i, col) / Entry(i, incol));
+    }
+    best.erase(std::remove_if(best.begin(), best.end(),
+                              [&](int i) {
+                                return Entry(i, col) / Entry(i, incol) < tempmax - eps1;
+                              }),
+               best.end());
+  }
+  return best.front();
+}
+
+void DenseLHTableau::System::Pivot(int p_outrow, int p_inlabel)
+{
+  if (!RowIndex(p_outrow) || !ValidIndex(p_inlabel)) {
+    throw BadPivot();
+  }
+  const int outrow = p_outrow - m_minRow;
+  const int incol = Column(p_inlabel);
+  double *pivotRow = &m_data[static_cast<size_t>(outrow) * m_width];
+  const double pivot = pivotRow[incol];
+  if (pivot == 0.0) {
+    throw BadPivot();
+  }
+
+  for (int k = 0; k < m_width; k++) {
+    pivotRow[k] /= pivot;
+  }
+  const int numRows = m_maxRow - m_minRow + 1;
+  for (int i = 0; i < numRows; i++) {
+    double *row = &m_data[static_cast<size_t>(i) * m_width];
+    const double factor = row[incol];
+    if (i == outrow || factor == 0.0) {
+      continue;
+    }
+    // This is the bulk of the work; the loop is over contiguous memory
+    // so that the compiler can vectorize it
+    for (int k = 0; k < m_width; k++) {
+      row[k] -= factor * pivotRow[k];
+    }
+    row[incol] = 0.0;
+  }
+  pivotRow[incol] = 1.0;
+
+  m_row[Column(m_basis[outrow])] = -1;
+  m_basis[outrow] = p_inlabel;
+  m_row[incol] = p_outrow;
+  m_numPivots++;
+}
+
+//---------------------------------------------------------------------------
+//                     DenseLHTableau: Lifecycle
+//---------------------------------------------------------------------------
+
+DenseLHTableau::DenseLHTableau(const Matrix<double> &A1, const Matrix<double> &A2,
+                               const Vector<double> &b1, const Vector<double> &b2)
+  : m_T1(A1, b1), m_T2(A2, b2)
+{
+}
+
+bool DenseLHTableau::IsDense(int p_n1, int p_n2)
+{
+  // The two systems together have (n1 + n2) * (n1 + n2 + 1) entries; this
+  // allows games with up to about 1400 strategies in all, using 16Mb for
+  // each copy of the tableau.
+  const long n = static_cast<long>(p_n1) + p_n2;
+  return n * (n + 1) <= (1L << 21);
+}
+
+//---------------------------------------------------------------------------
+//                   DenseLHTableau: Miscellaneous functions
+//---------------------------------------------------------------------------
+
+BFS<double> DenseLHTableau::GetBFS() const
+{
+  BFS<double> cbfs;
+  for (int i = MinCol(); i <= MaxCol(); i++) {
+    for (const System *system : {&m_T1, &m_T2}) {
+      if (system->Member(i)) {
+        const int row = system->m_row[system->Column(i)];
+        cbfs.insert(i, system->Entry(row, system->m_width - 1));
+      }
+    }
+  }
+  return cbfs;
+}
+
+int DenseLHTableau::Label(int p_row) const
+{
+  if (m_T1.RowIndex(p_row)) {
+    return m_T1.m_basis[p_row - m_T1.m_minRow];
+  }
+  if (m_T2.RowIndex(p_row)) {
+    return m_T2.m_basis[p_row - m_T2.m_minRow];
+  }
+  return 0;
+}
+
+int DenseLHTableau::PivotIn(int p_inlabel)
+{
+  for (System *system : {&m_T1, &m_T2}) {
+    if (system->ValidIndex(p_inlabel)) {
+      const int outrow = system->ExitIndex(p_inlabel);
+      const int outlabel = Label(outrow);
+      system->Pivot(outrow, p_inlabel);
+      return outlabel;
+    }
+  }
+  return 0;
+}
+
+int DenseLHTableau::LemkePath(int dup)
+{
+  int enter, exit;
+  enter = dup;
+  if (Member(dup)) {
+    enter = -dup;
+  }
+  // Central loop - pivot until another CBFS is found
+  do {
+    exit = PivotIn(enter);
+    enter = -exit;
+  } while ((exit != dup) && (exit != -dup));
+  return 1;
+}
+
+} // namespace linalg
+} // end namespace Gambit
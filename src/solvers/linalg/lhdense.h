@@ -0,0 +1,140 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2024, The Gambit Project (http://www.gambit-project.org)
+//
+// FILE: src/solvers/linalg/lhdense.h
+// Dense tableau for the Lemke-Howson algorithm in floating-point arithmetic
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#ifndef GAMBIT_LINALG_LHDENSE_H
+#define GAMBIT_LINALG_LHDENSE_H
+
+#include <vector>
+
+#include "gambit.h"
+#include "bfs.h"
+
+namespace Gambit {
+namespace linalg {
+
+///
+/// A Lemke-Howson tableau for a bimatrix game, as LHTableau<double>, which
+/// keeps each of the two systems as a dense array of the current tableau
+/// rows, stored contiguously in row-major order.  A pivot updates each row
+/// in place by a multiple of the pivot row, rather than extending a
+/// factorization of the basis; copying the tableau is a copy of the arrays,
+/// which makes saving and restoring the tableau when exploring several
+/// paths from one basis cheap.
+///
+/// The labels, and the rule for choosing the variable leaving the basis,
+/// are those of LHTableau, so that both follow the same paths.
+///
+class DenseLHTableau {
+public:
+  class BadPivot : public Exception {
+  public:
+    ~BadPivot() noexcept override = default;
+    const char *what() const noexcept override { return "Bad pivot in DenseLHTableau"; }
+  };
+  class BadExitIndex : public Exception {
+  public:
+    ~BadExitIndex() noexcept override = default;
+    const char *what() const noexcept override { return "Bad exit index in DenseLHTableau"; }
+  };
+
+  /// @name Lifecycle
+  //@{
+  DenseLHTableau(const Matrix<double> &A1, const Matrix<double> &A2, const Vector<double> &b1,
+                 const Vector<double> &b2);
+  DenseLHTableau(const DenseLHTableau &) = default;
+  ~DenseLHTableau() = default;
+
+  DenseLHTableau &operator=(const DenseLHTableau &) = default;
+
+  /// Returns true if the tableau for a game with p_n1 and p_n2 strategies
+  /// is small enough to be held densely
+  static bool IsDense(int p_n1, int p_n2);
+  //@}
+
+  /// @name General information
+  //@{
+  int MinCol() const { return m_T2.m_minCol; }
+  int MaxCol() const { return m_T1.m_maxCol; }
+  bool Member(int i) const { return m_T1.Member(i) || m_T2.Member(i); }
+  long NumPivots() const { return m_T1.m_numPivots + m_T2.m_numPivots; }
+  //@}
+
+  /// @name Miscellaneous functions
+  //@{
+  BFS<double> GetBFS() const;
+  /// Follow a path of ACBFS's from one CBFS to another
+  int LemkePath(int dup);
+  //@}
+
+private:
+  /// One of the two systems of the tableau
+  class System {
+  public:
+    /// Range of the rows, and of the labels of the columns of the matrix
+    int m_minRow, m_maxRow, m_minCol, m_maxCol;
+    /// Number of entries in each row: the columns of the matrix, then the
+    /// slack columns, then the right-hand side
+    int m_width;
+    /// The tableau, in row-major order
+    std::vector<double> m_data;
+    /// The label of the basic variable in each row
+    std::vector<int> m_basis;
+    /// The row of each variable in the basis (or -1 if it is nonbasic),
+    /// indexed by column in the tableau
+    std::vector<int> m_row;
+    long m_numPivots{0};
+
+    System(const Matrix<double> &A, const Vector<double> &b);
+
+    bool RowIndex(int p_row) const { return m_minRow <= p_row && p_row <= m_maxRow; }
+    bool ValidIndex(int p_label) const
+    {
+      return (m_minCol <= p_label && p_label <= m_maxCol) || RowIndex(-p_label);
+    }
+    /// The column of the tableau for the label
+    int Column(int p_label) const
+    {
+      return (p_label > 0) ? p_label - m_minCol : m_maxCol - m_minCol + 1 - p_label - m_minRow;
+    }
+    bool Member(int p_label) const
+    {
+      return ValidIndex(p_label) && m_row[Column(p_label)] >= 0;
+    }
+    double Entry(int p_row, int p_column) const
+    {
+      return m_data[(p_row - m_minRow) * m_width + p_column];
+    }
+
+    int ExitIndex(int p_inlabel) const;
+    void Pivot(int p_outrow, int p_inlabel);
+  };
+
+  System m_T1, m_T2;
+
+  int Label(int p_row) const;
+  int PivotIn(int p_inlabel);
+};
+
+} // namespace linalg
+} // end namespace Gambit
+
+#endif // GAMBIT_LINALG_LHDENSE_H
@@ -23,6 +23,8 @@
 #ifndef LUDECOMP_H
 #define LUDECOMP_H
 
+#include <atomic>
+
 #include "gambit.h"
 #include "basis.h"
 
@@ -70,7 +72,8 @@ private:
   int total_operations;
 
   const LUdecomp<T> *parent;
-  int copycount;
+  /// Copies may be made of the same decomposition on several threads
+  std::atomic<int> copycount;
 
   // don't use this copy constructor
   LUdecomp(const LUdecomp<T> &a);
@@ -141,12 +144,15 @@ private:
   bool CheckBasis();
   bool RefactorCheck();
 
-  void BTransE(Vector<T> &) const;
-  void FTransE(Vector<T> &) const;
-  void BTransU(Vector<T> &) const;
-  void FTransU(Vector<T> &) const;
-  void LPd_Trans(Vector<T> &) const;
-  void yLP_Trans(Vector<T> &) const;
+  void solve(const Vector<T> &, Vector<T> &, Vector<T> &p_scratch) const;
+  void solveT(const Vector<T> &, Vector<T> &, Vector<T> &p_scratch) const;
+
+  void BTransE(Vector<T> &, Vector<T> &p_scratch) const;
+  void FTransE(Vector<T> &, Vector<T> &p_scratch) const;
+  void BTransU(Vector<T> &, Vector<T> &p_scratch) const;
+  void FTransU(Vector<T> &, Vector<T> &p_scratch) const;
+  void LPd_Trans(Vector<T> &, Vector<T> &p_scratch) const;
+  void yLP_Trans(Vector<T> &, Vector<T> &p_scratch) const;
 
   void VectorEtaSolve(const Vector<T> &v, const EtaMatrix<T> &, Vector<T> &y) const;
 
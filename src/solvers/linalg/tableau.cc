@@ -373,15 +373,29 @@ void Tableau<Rational>::Pivot(int outrow, int in_col)
 
   // Step 3
 
+  // Where Cij* is zero, Step 3 only rescales row i, and zero entries in it
+  // remain zero.
+  const Integer &pivot = Tabdat(row, col);
   for (i = Tabdat.MinRow(); i <= Tabdat.MaxRow(); ++i) {
     if (i != row) {
+      const Integer &factor = Tabdat(i, col);
+      if (factor == 0) {
+        for (j = Tabdat.MinCol(); j <= Tabdat.MaxCol(); ++j) {
+          if (j != col && Tabdat(i, j) != 0) {
+            Tabdat(i, j) = (pivot * Tabdat(i, j)) / denom;
+          }
+        }
+        if (Coeff[i] != 0) {
+          Coeff[i] = (pivot * Coeff[i]) / denom;
+        }
+        continue;
+      }
       for (j = Tabdat.MinCol(); j <= Tabdat.MaxCol(); ++j) {
         if (j != col) {
-          Tabdat(i, j) =
-              (Tabdat(row, col) * Tabdat(i, j) - Tabdat(row, j) * Tabdat(i, col)) / denom;
+          Tabdat(i, j) = (pivot * Tabdat(i, j) - Tabdat(row, j) * factor) / denom;
         }
       }
-      Coeff[i] = (Tabdat(row, col) * Coeff[i] - Coeff[row] * Tabdat(i, col)) / denom;
+      Coeff[i] = (pivot * Coeff[i] - Coeff[row] * factor) / denom;
     }
   }
   // Step 2
@@ -415,28 +429,31 @@ void Tableau<Rational>::Pivot(int outrow, int in_col)
   // Refactor();
 }
 
+// Each entry is formed from its numerator and denominator in the integer
+// tableau, so that it is normalized only once.
 void Tableau<Rational>::SolveColumn(int in_col, Vector<Rational> &out)
 {
-  Vector<Integer> tempcol(tmpcol.First(), tmpcol.Last());
   if (Member(in_col)) {
     out = (Rational)0;
-    out[Find(in_col)] = Rational(abs(denom));
-  }
-  else {
-    int col = remap(in_col);
-    Tabdat.GetColumn(col, tempcol);
-    for (int i = tempcol.First(); i <= tempcol.Last(); i++) {
-      out[i] = (Rational)(tempcol[i]) * (Rational)(sign(denom * totdenom));
-    }
-  }
-  out = out / (Rational)abs(denom);
-  if (in_col < 0) {
-    out *= Rational(totdenom);
+    out[Find(in_col)] = (Rational)1;
+    return;
   }
+  int col = remap(in_col);
+  bool negative = sign(denom * totdenom) < 0;
   for (int i = out.First(); i <= out.Last(); i++) {
+    if (Tabdat(i, col) == 0) {
+      out[i] = (Rational)0;
+      continue;
+    }
+    Integer num = (negative) ? -Tabdat(i, col) : Tabdat(i, col);
+    Integer den = abs(denom);
+    if (in_col < 0) {
+      num *= totdenom;
+    }
     if (Label(i) < 0) {
-      out[i] = (Rational)out[i] / (Rational)totdenom;
+      den *= totdenom;
     }
+    out[i] = Rational(num, den);
   }
 }
 
@@ -531,15 +548,67 @@ void Tableau<Rational>::SetBasis(const Basis &in)
 // solve M x = b
 void Tableau<Rational>::Solve(const Vector<Rational> &b, Vector<Rational> &x)
 {
-  // Here, we do x = V * b, where V = M inverse
-  x = (GetInverse() * b) / (Rational)abs(denom);
+  // Here, we do x = V * b, where V = M inverse.  Column j of abs(denom) * V
+  // is column -j of the integer tableau; b is brought to the common
+  // denominator lcd, so that x is accumulated in integers.
+  Integer lcd = find_lcd(b);
+  bool negative = sign(denom * totdenom) < 0;
+  Vector<Integer> num(x.First(), x.Last());
+  num = Integer(0);
+  for (int j = b.First(); j <= b.Last(); j++) {
+    if (b[j] == (Rational)0) {
+      continue;
+    }
+    Integer bj = b[j].numerator() * (lcd / b[j].denominator());
+    if (Member(-j)) {
+      num[Find(-j)] += bj * abs(denom);
+    }
+    else {
+      int col = remap(-j);
+      if (negative) {
+        bj.negate();
+      }
+      for (int i = num.First(); i <= num.Last(); i++) {
+        if (Tabdat(i, col) != 0) {
+          num[i] += Tabdat(i, col) * bj;
+        }
+      }
+    }
+  }
+  Integer den = lcd * abs(denom);
+  for (int i = x.First(); i <= x.Last(); i++) {
+    x[i] = Rational(num[i], den);
+  }
 }
 
 // solve y M = c
 void Tableau<Rational>::SolveT(const Vector<Rational> &c, Vector<Rational> &y)
 {
-  // Here we do y = c * V, where V = M inverse
-  y = (c * GetInverse()) / (Rational)abs(denom);
+  // Here we do y = c * V, where V = M inverse, in integers as in Solve()
+  Integer lcd = find_lcd(c);
+  bool negative = sign(denom * totdenom) < 0;
+  Vector<Integer> cnum(c.First(), c.Last());
+  for (int i = c.First(); i <= c.Last(); i++) {
+    cnum[i] = c[i].numerator() * (lcd / c[i].denominator());
+  }
+  Integer den = lcd * abs(denom);
+  for (int j = y.First(); j <= y.Last(); j++) {
+    if (Member(-j)) {
+      y[j] = c[Find(-j)];
+      continue;
+    }
+    int col = remap(-j);
+    Integer num(0);
+    for (int i = cnum.First(); i <= cnum.Last(); i++) {
+      if (cnum[i] != 0 && Tabdat(i, col) != 0) {
+        num += cnum[i] * Tabdat(i, col);
+      }
+    }
+    if (negative) {
+      num.negate();
+    }
+    y[j] = Rational(num, den);
+  }
 }
 
 bool Tableau<Rational>::IsFeasible()
@@ -572,17 +641,36 @@ bool Tableau<Rational>::IsLexMin()
 
 void Tableau<Rational>::BasisVector(Vector<Rational> &out) const
 {
-  out = solution;
-  out = out / (Rational)abs(denom);
   for (int i = out.First(); i <= out.Last(); i++) {
-    if (Label(i) < 0) {
-      out[i] = out[i] / (Rational)totdenom;
-    }
+    out[i] = Rational(solution[i].numerator(),
+                      (Label(i) < 0) ? abs(denom) * totdenom : abs(denom));
   }
 }
 
 Integer Tableau<Rational>::TotDenom() const { return totdenom; }
 
+void Tableau<Rational>::IntegerColumn(int in_col, Vector<Integer> &out) const
+{
+  if (Member(in_col)) {
+    out = Integer(0);
+    out[Find(in_col)] = abs(denom);
+    return;
+  }
+  int col = remap(in_col);
+  bool negative = sign(denom * totdenom) < 0;
+  for (int i = out.First(); i <= out.Last(); i++) {
+    out[i] = (negative) ? -Tabdat(i, col) : Tabdat(i, col);
+  }
+}
+
+void Tableau<Rational>::IntegerBasisVector(Vector<Integer> &out) const
+{
+  // The entries of solution are integers (see Pivot())
+  for (int i = out.First(); i <= out.Last(); i++) {
+    out[i] = solution[i].numerator();
+  }
+}
+
 } // namespace linalg
 
 } // end namespace Gambit
@@ -125,6 +125,13 @@ public:
   bool IsLexMin();
   void BasisVector(Vector<Rational> &out) const override;
   Integer TotDenom() const;
+
+  // As SolveColumn() and BasisVector(), but taken directly from the integer
+  // tableau.  Each entry differs from the rational one by a positive factor
+  // which depends only on its row and on the column, so that ratios of
+  // entries in the same row may be compared without forming rationals.
+  void IntegerColumn(int, Vector<Integer> &) const;
+  void IntegerBasisVector(Vector<Integer> &) const;
 };
 
 } // namespace linalg
@@ -102,8 +102,10 @@ private:
 
     virtual double Value(const LogBehavProfile<double> &p_point, double p_lambda) const = 0;
 
+    /// Computes the gradient, given the derivatives of the action values
+    /// as computed by LogBehavProfile::DiffActionValues
     virtual void Gradient(const LogBehavProfile<double> &p_point, double p_lambda,
-                          Vector<double> &p_gradient) const = 0;
+                          const Matrix<double> &p_derivs, Vector<double> &p_gradient) const = 0;
   };
 
   //
@@ -126,7 +128,7 @@ private:
     double Value(const LogBehavProfile<double> &p_profile, double p_lambda) const override;
 
     void Gradient(const LogBehavProfile<double> &p_profile, double p_lambda,
-                  Vector<double> &p_gradient) const override;
+                  const Matrix<double> &p_derivs, Vector<double> &p_gradient) const override;
   };
 
   //
@@ -139,18 +141,20 @@ private:
     Game m_game;
     int m_pl, m_iset, m_act;
     GameInfoset m_infoset;
+    // The index in the profile of the first action at the information set
+    int m_offset;
 
   public:
-    RatioEquation(const Game &p_game, int p_player, int p_infoset, int p_action)
+    RatioEquation(const Game &p_game, int p_player, int p_infoset, int p_action, int p_offset)
       : m_game(p_game), m_pl(p_player), m_iset(p_infoset), m_act(p_action),
-        m_infoset(p_game->GetPlayer(p_player)->GetInfoset(p_infoset))
+        m_infoset(p_game->GetPlayer(p_player)->GetInfoset(p_infoset)), m_offset(p_offset)
     {
     }
 
     double Value(const LogBehavProfile<double> &p_profile, double p_lambda) const override;
 
     void Gradient(const LogBehavProfile<double> &p_profile, double p_lambda,
-                  Vector<double> &p_gradient) const override;
+                  const Matrix<double> &p_derivs, Vector<double> &p_gradient) const override;
   };
 
   Array<Equation *> m_equations;
@@ -159,13 +163,15 @@ private:
 
 EquationSystem::EquationSystem(const Game &p_game) : m_game(p_game)
 {
+  int offset = 1;
   for (int pl = 1; pl <= m_game->NumPlayers(); pl++) {
     GamePlayer player = m_game->GetPlayer(pl);
     for (int iset = 1; iset <= player->NumInfosets(); iset++) {
       m_equations.push_back(new SumToOneEquation(m_game, pl, iset));
       for (int act = 2; act <= player->GetInfoset(iset)->NumActions(); act++) {
-        m_equations.push_back(new RatioEquation(m_game, pl, iset, act));
+        m_equations.push_back(new RatioEquation(m_game, pl, iset, act, offset));
       }
+      offset += player->GetInfoset(iset)->NumActions();
     }
   }
 }
@@ -188,7 +194,8 @@ double EquationSystem::SumToOneEquation::Value(const LogBehavProfile<double> &p_
 }
 
 void EquationSystem::SumToOneEquation::Gradient(const LogBehavProfile<double> &p_profile,
-                                                double p_lambda, Vector<double> &p_gradient) const
+                                                double p_lambda, const Matrix<double> &,
+                                                Vector<double> &p_gradient) const
 {
   int i = 1;
   for (int pl = 1; pl <= m_game->NumPlayers(); pl++) {
@@ -221,7 +228,8 @@ double EquationSystem::RatioEquation::Value(const LogBehavProfile<double> &p_pro
 }
 
 void EquationSystem::RatioEquation::Gradient(const LogBehavProfile<double> &p_profile,
-                                             double p_lambda, Vector<double> &p_gradient) const
+                                             double p_lambda, const Matrix<double> &p_derivs,
+                                             Vector<double> &p_gradient) const
 {
   int i = 1;
   for (int pl = 1; pl <= m_game->NumPlayers(); pl++) {
@@ -242,9 +250,7 @@ void EquationSystem::RatioEquation::Gradient(const LogBehavProfile<double> &p_pr
         }
         else { // infoset1 != infoset2
           p_gradient[i] =
-              -p_lambda *
-              (p_profile.DiffActionValue(m_infoset->GetAction(m_act), infoset->GetAction(act)) -
-               p_profile.DiffActionValue(m_infoset->GetAction(1), infoset->GetAction(act)));
+              -p_lambda * (p_derivs(m_offset + m_act - 1, i) - p_derivs(m_offset, i));
         }
       }
     }
@@ -267,10 +273,12 @@ void EquationSystem::GetJacobian(const Vector<double> &p_point, Matrix<double> &
 {
   LogBehavProfile<double> profile(PointToLogProfile(m_game, p_point));
   double lambda = p_point.back();
+  Matrix<double> derivs(profile.BehaviorProfileLength(), profile.BehaviorProfileLength());
+  profile.DiffActionValues(derivs);
 
   for (int i = 1; i <= m_equations.Length(); i++) {
     Vector<double> column(p_point.Length());
-    m_equations[i]->Gradient(profile, lambda, column);
+    m_equations[i]->Gradient(profile, lambda, derivs, column);
     p_matrix.SetColumn(i, column);
   }
 }
@@ -344,11 +352,13 @@ namespace Gambit {
 List<LogitQREMixedBehaviorProfile> LogitBehaviorSolve(const LogitQREMixedBehaviorProfile &p_start,
                                                       double p_regret, double p_omega,
                                                       double p_firstStep, double p_maxAccel,
-                                                      MixedBehaviorObserverFunctionType p_observer)
+                                                      MixedBehaviorObserverFunctionType p_observer,
+                                                      bool p_broyden)
 {
   PathTracer tracer;
   tracer.SetMaxDecel(p_maxAccel);
   tracer.SetStepsize(p_firstStep);
+  tracer.SetBroydenUpdates(p_broyden);
 
   double scale = p_start.GetGame()->GetMaxPayoff() - p_start.GetGame()->GetMinPayoff();
   if (scale != 0.0) {
@@ -378,11 +388,13 @@ std::list<LogitQREMixedBehaviorProfile>
 LogitBehaviorSolveLambda(const LogitQREMixedBehaviorProfile &p_start,
                          const std::list<double> &p_targetLambda, double p_omega,
                          double p_firstStep, double p_maxAccel,
-                         MixedBehaviorObserverFunctionType p_observer)
+                         MixedBehaviorObserverFunctionType p_observer,
+                         bool p_broyden)
 {
   PathTracer tracer;
   tracer.SetMaxDecel(p_maxAccel);
   tracer.SetStepsize(p_firstStep);
+  tracer.SetBroydenUpdates(p_broyden);
 
   Game game = p_start.GetGame();
   Vector<double> x(ProfileToPoint(p_start));
@@ -410,12 +422,14 @@ LogitBehaviorSolveLambda(const LogitQREMixedBehaviorProfile &p_start,
 LogitQREMixedBehaviorProfile
 LogitBehaviorEstimate(const MixedBehaviorProfile<double> &p_frequencies, double p_maxLambda,
                       double p_omega, double p_stopAtLocal, double p_firstStep, double p_maxAccel,
-                      MixedBehaviorObserverFunctionType p_observer)
+                      MixedBehaviorObserverFunctionType p_observer,
+                      bool p_broyden)
 {
   LogitQREMixedBehaviorProfile start(p_frequencies.GetGame());
   PathTracer tracer;
   tracer.SetMaxDecel(p_maxAccel);
   tracer.SetStepsize(p_firstStep);
+  tracer.SetBroydenUpdates(p_broyden);
 
   Vector<double> x(ProfileToPoint(start)), restart(x);
   Vector<double> freq_vector(static_cast<const Vector<double> &>(p_frequencies));
@@ -54,19 +54,33 @@ protected:
   Game m_game;
   DVector<T> m_probs, m_logProbs;
 
-  // structures for storing cached data
+  // structures for storing cached data: nodes, indexed by node number
   mutable bool m_cacheValid;
-  mutable std::map<GameNode, T> m_logRealizProbs;
-  mutable std::map<GameNode, T> m_beliefs;
-  mutable std::map<GameNode, std::map<GamePlayer, T>> m_nodeValues;
-  mutable std::map<GameAction, T> m_actionValues;
-
-  const T &ActionValue(const GameAction &act) const { return m_actionValues[act]; }
+  mutable std::vector<T> m_logRealizProbs, m_beliefs;
+  /// Values of the nodes to each player, stored node-major with one entry per player
+  mutable std::vector<T> m_nodeValues;
+  // structures for storing cached data: information sets, indexed as in the compiled tree
+  mutable std::vector<T> m_infosetProbs, m_infosetMaxLogProbs, m_infosetTotals;
+  // structures for storing cached data: actions
+  mutable DVector<T> m_actionValues;
+
+  const T &NodeValue(const GameNode &p_node, const GamePlayer &p_player) const
+  {
+    return m_nodeValues[(p_node->GetNumber() - 1) * m_game->NumPlayers() +
+                        p_player->GetNumber() - 1];
+  }
 
   /// @name Auxiliary functions for computation of interesting values
   //@{
-  void ComputeSolutionDataPass2(const GameNode &node) const;
-  void ComputeSolutionDataPass1(const GameNode &node) const;
+  /// Returns the log of the probability of the p_action'th action at the
+  /// p_node'th node of the compiled tree
+  T GetLogActionProb(const CompiledGameTree &p_tree, int p_node, int p_action) const;
+  /// Computes log-realization probabilities and path payoffs in a forward sweep
+  void ComputeForwardSweep(const CompiledGameTree &p_tree) const;
+  /// Computes node values in a backward sweep
+  void ComputeBackwardSweep(const CompiledGameTree &p_tree) const;
+  /// Computes beliefs and action values in a forward sweep
+  void ComputeBeliefs_actionValues(const CompiledGameTree &p_tree) const;
   void ComputeSolutionData() const;
   //@}
 
@@ -130,9 +144,9 @@ public:
   T GetLogActionProb(const GameAction &) const;
   const T &GetPayoff(const GameAction &act) const;
 
-  T DiffActionValue(const GameAction &action, const GameAction &oppAction) const;
-  T DiffNodeValue(const GameNode &node, const GamePlayer &player,
-                  const GameAction &oppAction) const;
+  /// Computes the derivative of the value of each action (rows) with respect
+  /// to the log-probability of each action (columns), indexed as in the profile
+  void DiffActionValues(Matrix<T> &p_derivs) const;
 
   //@}
 };
@@ -87,18 +87,39 @@ inline void NullMixedStrategyObserver(const LogitQREMixedStrategyProfile &) {}
 List<LogitQREMixedStrategyProfile>
 LogitStrategySolve(const LogitQREMixedStrategyProfile &p_start, double p_regret, double p_omega,
                    double p_firstStep, double p_maxAccel,
-                   MixedStrategyObserverFunctionType p_observer = NullMixedStrategyObserver);
+                   MixedStrategyObserverFunctionType p_observer = NullMixedStrategyObserver,
+                   bool p_broyden = false);
 
 std::list<LogitQREMixedStrategyProfile>
 LogitStrategySolveLambda(const LogitQREMixedStrategyProfile &p_start,
                          const std::list<double> &p_targetLambda, double p_omega,
                          double p_firstStep, double p_maxAccel,
-                         MixedStrategyObserverFunctionType p_observer = NullMixedStrategyObserver);
+                         MixedStrategyObserverFunctionType p_observer = NullMixedStrategyObserver,
+                         bool p_broyden = false);
+
+/// Traces the branch from p_start through each list of targets in p_targetLambdas,
+/// independently and using up to p_numThreads threads (zero meaning one for each
+/// hardware thread).  Tracing is divided among threads only for strategic games.
+std::list<std::list<LogitQREMixedStrategyProfile>>
+LogitStrategySolveLambda(const LogitQREMixedStrategyProfile &p_start,
+                         const std::list<std::list<double>> &p_targetLambdas, double p_omega,
+                         double p_firstStep, double p_maxAccel, int p_numThreads,
+                         bool p_broyden = false);
 
 LogitQREMixedStrategyProfile
 LogitStrategyEstimate(const MixedStrategyProfile<double> &p_frequencies, double p_maxLambda,
                       double p_omega, double p_stopAtLocal, double p_firstStep, double p_maxAccel,
-                      MixedStrategyObserverFunctionType p_observer = NullMixedStrategyObserver);
+                      MixedStrategyObserverFunctionType p_observer = NullMixedStrategyObserver,
+                      bool p_broyden = false);
+
+/// Computes the estimate for each of p_frequencies, which must be defined on the
+/// same game, using up to p_numThreads threads (zero meaning one for each
+/// hardware thread).  Tracing is divided among threads only for strategic games.
+std::list<LogitQREMixedStrategyProfile>
+LogitStrategyEstimate(const std::list<MixedStrategyProfile<double>> &p_frequencies,
+                      double p_maxLambda, double p_omega, double p_stopAtLocal,
+                      double p_firstStep, double p_maxAccel, int p_numThreads,
+                      bool p_broyden = false);
 
 using LogitQREMixedBehaviorProfile = LogitQRE<MixedBehaviorProfile<double>>;
 
@@ -110,18 +131,21 @@ inline void NullMixedBehaviorObserver(const LogitQREMixedBehaviorProfile &) {}
 List<LogitQREMixedBehaviorProfile>
 LogitBehaviorSolve(const LogitQREMixedBehaviorProfile &p_start, double p_regret, double p_omega,
                    double p_firstStep, double p_maxAccel,
-                   MixedBehaviorObserverFunctionType p_observer = NullMixedBehaviorObserver);
+                   MixedBehaviorObserverFunctionType p_observer = NullMixedBehaviorObserver,
+                   bool p_broyden = false);
 
 std::list<LogitQREMixedBehaviorProfile>
 LogitBehaviorSolveLambda(const LogitQREMixedBehaviorProfile &p_start,
                          const std::list<double> &p_targetLambda, double p_omega,
                          double p_firstStep, double p_maxAccel,
-                         MixedBehaviorObserverFunctionType p_observer = NullMixedBehaviorObserver);
+                         MixedBehaviorObserverFunctionType p_observer = NullMixedBehaviorObserver,
+                         bool p_broyden = false);
 
 LogitQREMixedBehaviorProfile
 LogitBehaviorEstimate(const MixedBehaviorProfile<double> &p_frequencies, double p_maxLambda,
                       double p_omega, double p_stopAtLocal, double p_firstStep, double p_maxAccel,
-                      MixedBehaviorObserverFunctionType p_observer = NullMixedBehaviorObserver);
+                      MixedBehaviorObserverFunctionType p_observer = NullMixedBehaviorObserver,
+                      bool p_broyden = false);
 
 } // namespace Gambit
 
@@ -21,9 +21,14 @@
 // Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
 //
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <exception>
+#include <thread>
 
 #include "gambit.h"
+#include "games/gametable.h"
 #include "logit.h"
 #include "path.h"
 
@@ -76,59 +81,64 @@ bool RegretTerminationFunction(const Game &p_game, const Vector<double> &p_point
   return PointToProfile(p_game, p_point).GetMaxRegret() < p_regret;
 }
 
-void GetValue(const Game &p_game, const Vector<double> &p_point, Vector<double> &p_lhs)
+/// Returns the number of strategies of each player, in the order of the profile
+std::vector<int> StrategyCounts(const Game &p_game)
 {
-  MixedStrategyProfile<double> profile(PointToProfile(p_game, p_point)),
-      logprofile(p_game->NewMixedStrategyProfile(0.0));
-  for (size_t i = 1; i <= profile.MixedProfileLength(); i++) {
-    logprofile[i] = p_point[i];
+  std::vector<int> counts;
+  for (auto player : p_game->GetPlayers()) {
+    counts.push_back(player->GetStrategies().size());
   }
+  return counts;
+}
+
+/// Fills the equations defining the branch at p_point, given the number of
+/// strategies of each player and the strategy values at the point
+void AssembleValue(const std::vector<int> &p_dims, const Vector<double> &p_point,
+                   const Vector<double> &p_values, Vector<double> &p_lhs)
+{
   double lambda = p_point.back();
   p_lhs = 0.0;
-  for (int rowno = 0, pl = 1; pl <= p_game->NumPlayers(); pl++) {
-    GamePlayer player = p_game->GetPlayer(pl);
-    for (size_t st = 1; st <= player->GetStrategies().size(); st++) {
+  for (int rowno = 0, first = 1, pl = 1; pl <= static_cast<int>(p_dims.size());
+       first += p_dims[pl - 1], pl++) {
+    for (int st = 1; st <= p_dims[pl - 1]; st++) {
       rowno++;
       if (st == 1) {
         // This is a sum-to-one equation
         p_lhs[rowno] = -1.0;
-        for (size_t j = 1; j <= player->GetStrategies().size(); j++) {
-          p_lhs[rowno] += profile[player->GetStrategy(j)];
+        for (int j = 0; j < p_dims[pl - 1]; j++) {
+          p_lhs[rowno] += exp(p_point[first + j]);
         }
       }
       else {
         // This is a ratio equation
-        p_lhs[rowno] = (logprofile[player->GetStrategy(st)] - logprofile[player->GetStrategy(1)] -
-                        lambda * (profile.GetPayoff(player->GetStrategy(st)) -
-                                  profile.GetPayoff(player->GetStrategy(1))));
+        p_lhs[rowno] = (p_point[rowno] - p_point[first] -
+                        lambda * (p_values[rowno] - p_values[first]));
       }
     }
   }
 }
 
-void GetJacobian(const Game &p_game, const Vector<double> &p_point, Matrix<double> &p_matrix)
+/// Fills the Jacobian of the equations defining the branch at p_point, given
+/// the number of strategies of each player and the strategy values and their
+/// derivatives at the point
+void AssembleJacobian(const std::vector<int> &p_dims, const Vector<double> &p_point,
+                      const Vector<double> &p_values, const Matrix<double> &p_valueDerivs,
+                      Matrix<double> &p_matrix)
 {
-  MixedStrategyProfile<double> profile(PointToProfile(p_game, p_point)),
-      logprofile(p_game->NewMixedStrategyProfile(0.0));
-  for (size_t i = 1; i <= profile.MixedProfileLength(); i++) {
-    logprofile[i] = p_point[i];
-  }
+  const int numPlayers = p_dims.size();
   double lambda = p_point.back();
-
   p_matrix = 0.0;
 
-  for (int rowno = 0, i = 1; i <= p_game->NumPlayers(); i++) {
-    GamePlayer player = p_game->GetPlayer(i);
-    for (size_t j = 1; j <= player->GetStrategies().size(); j++) {
+  for (int rowno = 0, first = 1, i = 1; i <= numPlayers; first += p_dims[i - 1], i++) {
+    for (int j = 1; j <= p_dims[i - 1]; j++) {
       rowno++;
       if (j == 1) {
         // This is a sum-to-one equation
-        for (int colno = 0, ell = 1; ell <= p_game->NumPlayers(); ell++) {
-          GamePlayer player2 = p_game->GetPlayer(ell);
-          for (size_t m = 1; m <= player2->GetStrategies().size(); m++) {
+        for (int colno = 0, ell = 1; ell <= numPlayers; ell++) {
+          for (int m = 1; m <= p_dims[ell - 1]; m++) {
             colno++;
             if (i == ell) {
-              p_matrix(colno, rowno) = profile[player2->GetStrategy(m)];
+              p_matrix(colno, rowno) = exp(p_point[colno]);
             }
             // Otherwise, entry is zero
           }
@@ -137,9 +147,8 @@ void GetJacobian(const Game &p_game, const Vector<double> &p_point, Matrix<doubl
       }
       else {
         // This is a ratio equation
-        for (int colno = 0, ell = 1; ell <= p_game->NumPlayers(); ell++) {
-          GamePlayer player2 = p_game->GetPlayer(ell);
-          for (size_t m = 1; m <= player2->GetStrategies().size(); m++) {
+        for (int colno = 0, ell = 1; ell <= numPlayers; ell++) {
+          for (int m = 1; m <= p_dims[ell - 1]; m++) {
             colno++;
             if (i == ell) {
               if (m == 1) {
@@ -152,20 +161,73 @@ void GetJacobian(const Game &p_game, const Vector<double> &p_point, Matrix<doubl
             }
             else {
               p_matrix(colno, rowno) =
-                  -lambda * profile[player2->GetStrategy(m)] *
-                  (profile.GetPayoffDeriv(i, player->GetStrategy(j), player2->GetStrategy(m)) -
-                   profile.GetPayoffDeriv(i, player->GetStrategy(1), player2->GetStrategy(m)));
+                  -lambda * exp(p_point[colno]) *
+                  (p_valueDerivs(rowno, colno) - p_valueDerivs(first, colno));
             }
           }
         }
         // Fill the last column, the derivative wrt lambda
-        p_matrix(p_matrix.NumRows(), rowno) = (profile.GetPayoff(player->GetStrategy(1)) -
-                                               profile.GetPayoff(player->GetStrategy(j)));
+        p_matrix(p_matrix.NumRows(), rowno) = p_values[first] - p_values[rowno];
       }
     }
   }
 }
 
+void GetValue(const Game &p_game, const Vector<double> &p_point, Vector<double> &p_lhs)
+{
+  MixedStrategyProfile<double> profile(PointToProfile(p_game, p_point));
+  AssembleValue(StrategyCounts(p_game), p_point, profile.GetStrategyValues(), p_lhs);
+}
+
+void GetJacobian(const Game &p_game, const Vector<double> &p_point, Matrix<double> &p_matrix)
+{
+  MixedStrategyProfile<double> profile(PointToProfile(p_game, p_point));
+  AssembleJacobian(StrategyCounts(p_game), p_point, profile.GetStrategyValues(),
+                   profile.GetStrategyValueDerivs(), p_matrix);
+}
+
+/// The equations defining the branch for a table game, evaluated using a
+/// copy of its payoffs.  These refer to no game objects, so several branches
+/// may be traced at once on different threads.
+class TableEquations {
+public:
+  explicit TableEquations(const TablePayoffs &p_payoffs) : m_payoffs(p_payoffs)
+  {
+    for (int pl = 1; pl <= p_payoffs.NumPlayers(); pl++) {
+      m_dims.push_back(p_payoffs.NumStrategies(pl));
+    }
+  }
+
+  void GetValue(const Vector<double> &p_point, Vector<double> &p_lhs) const
+  {
+    Vector<double> probs(GetProbs(p_point)), values(probs.Length());
+    m_payoffs.GetStrategyValues(probs, values);
+    AssembleValue(m_dims, p_point, values, p_lhs);
+  }
+
+  void GetJacobian(const Vector<double> &p_point, Matrix<double> &p_matrix) const
+  {
+    Vector<double> probs(GetProbs(p_point)), values(probs.Length());
+    Matrix<double> valueDerivs(probs.Length(), probs.Length());
+    m_payoffs.GetStrategyValues(probs, values);
+    m_payoffs.GetStrategyValueDerivs(probs, valueDerivs);
+    AssembleJacobian(m_dims, p_point, values, valueDerivs, p_matrix);
+  }
+
+  Vector<double> GetProbs(const Vector<double> &p_point) const
+  {
+    Vector<double> probs(p_point.Length() - 1);
+    for (int i = 1; i <= probs.Length(); i++) {
+      probs[i] = exp(p_point[i]);
+    }
+    return probs;
+  }
+
+private:
+  const TablePayoffs &m_payoffs;
+  std::vector<int> m_dims;
+};
+
 class TracingCallbackFunction {
 public:
   TracingCallbackFunction(const Game &p_game, MixedStrategyObserverFunctionType p_observer)
@@ -229,16 +291,107 @@ void EstimatorCallbackFunction::EvaluatePoint(const Vector<double> &p_point)
   }
 }
 
+using EquationFunctionType = std::function<void(const Vector<double> &, Vector<double> &)>;
+using JacobianFunctionType = std::function<void(const Vector<double> &, Matrix<double> &)>;
+
+/// Traces the branch from p_x through each of p_targetLambda in turn, returning
+/// the point found at each
+std::list<Vector<double>> TraceLambdas(const PathTracer &p_tracer, EquationFunctionType p_function,
+                                       JacobianFunctionType p_jacobian, Vector<double> p_x,
+                                       double p_omega, const std::list<double> &p_targetLambda,
+                                       CallbackFunctionType p_callback = NullCallbackFunction)
+{
+  std::list<Vector<double>> points;
+  for (auto lam : p_targetLambda) {
+    p_tracer.TracePath(
+        p_function, p_jacobian, p_x, p_omega, LambdaPositiveTerminationFunction, p_callback,
+        [lam](const Vector<double> &x, const Vector<double> &) -> double {
+          return x.back() - lam;
+        });
+    points.push_back(p_x);
+  }
+  return points;
+}
+
+/// Traces the branch from p_x as far as p_maxLambda, locating the local maximizers
+/// of the likelihood of p_frequencies along it.  Unless p_stopAtLocal is set,
+/// tracing resumes past each local maximizer until p_maxLambda is reached.
+void TraceEstimate(const PathTracer &p_tracer, EquationFunctionType p_function,
+                   JacobianFunctionType p_jacobian, Vector<double> p_x, double p_omega,
+                   double p_maxLambda, bool p_stopAtLocal, const Vector<double> &p_frequencies,
+                   CallbackFunctionType p_callback)
+{
+  Vector<double> restart(p_x);
+  while (true) {
+    p_tracer.TracePath(
+        p_function, p_jacobian, p_x, p_omega,
+        [p_maxLambda](const Vector<double> &p_point) {
+          return LambdaRangeTerminationFunction(p_point, 0, p_maxLambda);
+        },
+        p_callback,
+        [&p_frequencies](const Vector<double> &, const Vector<double> &p_tangent) -> double {
+          return DiffLogLike(p_frequencies, p_tangent);
+        },
+        [&restart](const Vector<double> &, const Vector<double> &p_restart) -> void {
+          restart = p_restart;
+        });
+    if (p_stopAtLocal || p_x.back() >= p_maxLambda) {
+      break;
+    }
+    p_x = restart;
+  }
+}
+
+/// Calls p_run(i) for each run i in [0, p_runs), with the runs taken in turn by
+/// up to p_threads threads.  The first exception thrown by any run is rethrown
+/// on the calling thread once all threads have finished.
+template <class F> void RunConcurrently(size_t p_runs, int p_threads, F p_run)
+{
+  if (p_threads < 0) {
+    throw ValueException("Number of threads must be non-negative");
+  }
+  if (p_threads == 0) {
+    p_threads = static_cast<int>(std::max(1U, std::thread::hardware_concurrency()));
+  }
+  std::atomic<size_t> next(0);
+  std::vector<std::exception_ptr> errors(p_runs);
+  auto worker = [&]() {
+    for (size_t run = next++; run < p_runs; run = next++) {
+      try {
+        p_run(run);
+      }
+      catch (...) {
+        errors[run] = std::current_exception();
+      }
+    }
+  };
+  std::vector<std::thread> workers;
+  for (size_t t = 1; t < std::min(static_cast<size_t>(p_threads), p_runs); t++) {
+    workers.emplace_back(worker);
+  }
+  worker();
+  for (auto &thread : workers) {
+    thread.join();
+  }
+  for (const auto &error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
 } // namespace
 
 List<LogitQREMixedStrategyProfile> LogitStrategySolve(const LogitQREMixedStrategyProfile &p_start,
                                                       double p_regret, double p_omega,
                                                       double p_firstStep, double p_maxAccel,
-                                                      MixedStrategyObserverFunctionType p_observer)
+                                                      MixedStrategyObserverFunctionType p_observer,
+                                                      bool p_broyden)
 {
   PathTracer tracer;
   tracer.SetMaxDecel(p_maxAccel);
   tracer.SetStepsize(p_firstStep);
+  tracer.SetBroydenUpdates(p_broyden);
 
   double scale = p_start.GetGame()->GetMaxPayoff() - p_start.GetGame()->GetMinPayoff();
   if (scale != 0.0) {
@@ -266,29 +419,74 @@ std::list<LogitQREMixedStrategyProfile>
 LogitStrategySolveLambda(const LogitQREMixedStrategyProfile &p_start,
                          const std::list<double> &p_targetLambda, double p_omega,
                          double p_firstStep, double p_maxAccel,
-                         MixedStrategyObserverFunctionType p_observer)
+                         MixedStrategyObserverFunctionType p_observer,
+                         bool p_broyden)
 {
   PathTracer tracer;
   tracer.SetMaxDecel(p_maxAccel);
   tracer.SetStepsize(p_firstStep);
+  tracer.SetBroydenUpdates(p_broyden);
 
-  Vector<double> x(ProfileToPoint(p_start));
   TracingCallbackFunction callback(p_start.GetGame(), p_observer);
+  auto points = TraceLambdas(
+      tracer,
+      [&p_start](const Vector<double> &p_point, Vector<double> &p_lhs) {
+        GetValue(p_start.GetGame(), p_point, p_lhs);
+      },
+      [&p_start](const Vector<double> &p_point, Matrix<double> &p_jac) {
+        GetJacobian(p_start.GetGame(), p_point, p_jac);
+      },
+      ProfileToPoint(p_start), p_omega, p_targetLambda,
+      [&callback](const Vector<double> &p_point) -> void { callback.AppendPoint(p_point); });
   std::list<LogitQREMixedStrategyProfile> ret;
-  for (auto lam : p_targetLambda) {
-    tracer.TracePath(
-        [&p_start](const Vector<double> &p_point, Vector<double> &p_lhs) {
-          GetValue(p_start.GetGame(), p_point, p_lhs);
+  for (const auto &point : points) {
+    ret.emplace_back(PointToProfile(p_start.GetGame(), point), point.back(), 1.0);
+  }
+  return ret;
+}
+
+std::list<std::list<LogitQREMixedStrategyProfile>>
+LogitStrategySolveLambda(const LogitQREMixedStrategyProfile &p_start,
+                         const std::list<std::list<double>> &p_targetLambdas, double p_omega,
+                         double p_firstStep, double p_maxAccel, int p_numThreads,
+                         bool p_broyden)
+{
+  Game game = p_start.GetGame();
+  std::list<std::list<LogitQREMixedStrategyProfile>> ret;
+  if (!dynamic_cast<GameTableRep *>(game.operator->())) {
+    for (const auto &targets : p_targetLambdas) {
+      ret.push_back(LogitStrategySolveLambda(p_start, targets, p_omega, p_firstStep, p_maxAccel,
+                                             NullMixedStrategyObserver, p_broyden));
+    }
+    return ret;
+  }
+
+  PathTracer tracer;
+  tracer.SetMaxDecel(p_maxAccel);
+  tracer.SetStepsize(p_firstStep);
+  tracer.SetBroydenUpdates(p_broyden);
+
+  const TablePayoffs payoffs(game);
+  const TableEquations equations(payoffs);
+  const Vector<double> start(ProfileToPoint(p_start));
+  const std::vector<std::list<double>> targets(p_targetLambdas.begin(), p_targetLambdas.end());
+  std::vector<std::list<Vector<double>>> points(targets.size());
+  RunConcurrently(targets.size(), p_numThreads, [&](size_t p_run) {
+    points[p_run] = TraceLambdas(
+        tracer,
+        [&equations](const Vector<double> &p_point, Vector<double> &p_lhs) {
+          equations.GetValue(p_point, p_lhs);
         },
-        [&p_start](const Vector<double> &p_point, Matrix<double> &p_jac) {
-          GetJacobian(p_start.GetGame(), p_point, p_jac);
+        [&equations](const Vector<double> &p_point, Matrix<double> &p_jac) {
+          equations.GetJacobian(p_point, p_jac);
         },
-        x, p_omega, LambdaPositiveTerminationFunction,
-        [&callback](const Vector<double> &p_point) -> void { callback.AppendPoint(p_point); },
-        [lam](const Vector<double> &x, const Vector<double> &) -> double {
-          return x.back() - lam;
-        });
-    ret.push_back(callback.GetProfiles().back());
+        start, p_omega, targets[p_run]);
+  });
+  for (const auto &run : points) {
+    ret.emplace_back();
+    for (const auto &point : run) {
+      ret.back().emplace_back(PointToProfile(game, point), point.back(), 1.0);
+    }
   }
   return ret;
 }
@@ -296,42 +494,106 @@ LogitStrategySolveLambda(const LogitQREMixedStrategyProfile &p_start,
 LogitQREMixedStrategyProfile
 LogitStrategyEstimate(const MixedStrategyProfile<double> &p_frequencies, double p_maxLambda,
                       double p_omega, double p_stopAtLocal, double p_firstStep, double p_maxAccel,
-                      MixedStrategyObserverFunctionType p_observer)
+                      MixedStrategyObserverFunctionType p_observer,
+                      bool p_broyden)
 {
   LogitQREMixedStrategyProfile start(p_frequencies.GetGame());
   PathTracer tracer;
   tracer.SetMaxDecel(p_maxAccel);
   tracer.SetStepsize(p_firstStep);
+  tracer.SetBroydenUpdates(p_broyden);
 
-  Vector<double> x(ProfileToPoint(start)), restart(x);
   Vector<double> freq_vector(static_cast<const Vector<double> &>(p_frequencies));
-  EstimatorCallbackFunction callback(
-      start.GetGame(), static_cast<const Vector<double> &>(p_frequencies), p_observer);
-  while (true) {
-    tracer.TracePath(
-        [&start](const Vector<double> &p_point, Vector<double> &p_lhs) {
-          GetValue(start.GetGame(), p_point, p_lhs);
-        },
-        [&start](const Vector<double> &p_point, Matrix<double> &p_jac) {
-          GetJacobian(start.GetGame(), p_point, p_jac);
-        },
-        x, p_omega,
-        [p_maxLambda](const Vector<double> &p_point) {
-          return LambdaRangeTerminationFunction(p_point, 0, p_maxLambda);
+  EstimatorCallbackFunction callback(start.GetGame(), freq_vector, p_observer);
+  TraceEstimate(
+      tracer,
+      [&start](const Vector<double> &p_point, Vector<double> &p_lhs) {
+        GetValue(start.GetGame(), p_point, p_lhs);
+      },
+      [&start](const Vector<double> &p_point, Matrix<double> &p_jac) {
+        GetJacobian(start.GetGame(), p_point, p_jac);
+      },
+      ProfileToPoint(start), p_omega, p_maxLambda, p_stopAtLocal, freq_vector,
+      [&callback](const Vector<double> &p_point) -> void { callback.EvaluatePoint(p_point); });
+  return callback.GetMaximizer();
+}
+
+std::list<LogitQREMixedStrategyProfile>
+LogitStrategyEstimate(const std::list<MixedStrategyProfile<double>> &p_frequencies,
+                      double p_maxLambda, double p_omega, double p_stopAtLocal,
+                      double p_firstStep, double p_maxAccel, int p_numThreads, bool p_broyden)
+{
+  std::list<LogitQREMixedStrategyProfile> ret;
+  if (p_frequencies.empty()) {
+    return ret;
+  }
+  Game game = p_frequencies.front().GetGame();
+  for (const auto &frequencies : p_frequencies) {
+    if (frequencies.GetGame() != game) {
+      throw MismatchException();
+    }
+  }
+  if (!dynamic_cast<GameTableRep *>(game.operator->())) {
+    for (const auto &frequencies : p_frequencies) {
+      ret.push_back(LogitStrategyEstimate(frequencies, p_maxLambda, p_omega, p_stopAtLocal,
+                                          p_firstStep, p_maxAccel, NullMixedStrategyObserver,
+                                          p_broyden));
+    }
+    return ret;
+  }
+
+  PathTracer tracer;
+  tracer.SetMaxDecel(p_maxAccel);
+  tracer.SetStepsize(p_firstStep);
+  tracer.SetBroydenUpdates(p_broyden);
+
+  const TablePayoffs payoffs(game);
+  const TableEquations equations(payoffs);
+  const LogitQREMixedStrategyProfile start(game);
+  const Vector<double> startPoint(ProfileToPoint(start));
+  std::vector<Vector<double>> frequencies;
+  for (const auto &profile : p_frequencies) {
+    frequencies.emplace_back(static_cast<const Vector<double> &>(profile));
+  }
+  // As in the single estimate, the maximizer is the starting profile unless a
+  // point on the branch has strictly greater likelihood.  The points are
+  // converted to profiles only once all threads have finished.
+  const Vector<double> startProbs(static_cast<const Vector<double> &>(start.GetProfile()));
+  std::vector<Vector<double>> bestPoints(frequencies.size(), startPoint);
+  std::vector<double> bestLogLikes(frequencies.size());
+  std::vector<int> found(frequencies.size(), 0);
+  RunConcurrently(frequencies.size(), p_numThreads, [&](size_t p_run) {
+    const Vector<double> &freq_vector = frequencies[p_run];
+    double &bestLogLike = bestLogLikes[p_run];
+    bestLogLike = LogLike(freq_vector, startProbs);
+    TraceEstimate(
+        tracer,
+        [&equations](const Vector<double> &p_point, Vector<double> &p_lhs) {
+          equations.GetValue(p_point, p_lhs);
         },
-        [&callback](const Vector<double> &p_point) -> void { callback.EvaluatePoint(p_point); },
-        [freq_vector](const Vector<double> &, const Vector<double> &p_tangent) -> double {
-          return DiffLogLike(freq_vector, p_tangent);
+        [&equations](const Vector<double> &p_point, Matrix<double> &p_jac) {
+          equations.GetJacobian(p_point, p_jac);
         },
-        [&restart](const Vector<double> &, const Vector<double> &p_restart) -> void {
-          restart = p_restart;
+        startPoint, p_omega, p_maxLambda, p_stopAtLocal, freq_vector,
+        [&](const Vector<double> &p_point) -> void {
+          double logLike = LogLike(freq_vector, equations.GetProbs(p_point));
+          if (logLike > bestLogLike) {
+            bestLogLike = logLike;
+            bestPoints[p_run] = p_point;
+            found[p_run] = 1;
+          }
         });
-    if (p_stopAtLocal || x.back() >= p_maxLambda) {
-      break;
+  });
+  for (size_t run = 0; run < frequencies.size(); run++) {
+    if (found[run]) {
+      ret.emplace_back(PointToProfile(game, bestPoints[run]), bestPoints[run].back(),
+                       bestLogLikes[run]);
+    }
+    else {
+      ret.emplace_back(start.GetProfile(), start.GetLambda(), bestLogLikes[run]);
     }
-    x = restart;
   }
-  return callback.GetMaximizer();
+  return ret;
 }
 
 } // end namespace Gambit
@@ -22,6 +22,9 @@
 
 #include <cmath>
 #include <algorithm> // for std::max
+#include <list>
+#include <numeric>
+#include <vector>
 
 #include "gambit.h"
 #include "core/sqmatrix.h"
@@ -37,7 +40,57 @@ namespace {
 
 inline double sqr(double x) { return x * x; }
 
-void Givens(Matrix<double> &b, Matrix<double> &q, double &c1, double &c2, int l1, int l2, int l3)
+//
+// The nonzero entries of each row of a matrix lie in the columns from
+// first[row] to last[row].  The Jacobians of the logit systems are sparse,
+// so tracking these extents through the decomposition allows rotations to
+// skip the columns in which both rows are zero.  The extents only ever grow
+// by rotations, so this is the envelope (variable-band) form of Givens QR.
+//
+struct RowExtents {
+  std::vector<int> first, last;
+
+  // Extents of the rows of p_matrix, scanning its entries
+  void Scan(const Matrix<double> &p_matrix)
+  {
+    first.assign(p_matrix.NumRows() + 1, p_matrix.NumColumns() + 1);
+    last.assign(p_matrix.NumRows() + 1, 0);
+    for (int l = 1; l <= p_matrix.NumRows(); l++) {
+      for (int k = 1; k <= p_matrix.NumColumns(); k++) {
+        if (p_matrix(l, k) != 0.0) {
+          first[l] = std::min(first[l], k);
+          last[l] = k;
+        }
+      }
+    }
+  }
+
+  // Extents of the rows of the identity matrix with p_rows rows
+  void Identity(int p_rows)
+  {
+    first.resize(p_rows + 1);
+    last.resize(p_rows + 1);
+    std::iota(first.begin(), first.end(), 0);
+    std::iota(last.begin(), last.end(), 0);
+  }
+
+  // Extents of the rows of a dense matrix with p_rows rows and p_cols columns
+  void Full(int p_rows, int p_cols)
+  {
+    first.assign(p_rows + 1, 1);
+    last.assign(p_rows + 1, p_cols);
+  }
+
+  // Merge the extents of rows l1 and l2, which are being combined by a rotation
+  void Merge(int l1, int l2)
+  {
+    first[l1] = first[l2] = std::min(first[l1], first[l2]);
+    last[l1] = last[l2] = std::max(last[l1], last[l2]);
+  }
+};
+
+void Givens(Matrix<double> &b, Matrix<double> &q, RowExtents &bRows, RowExtents &qRows,
+            double &c1, double &c2, int l1, int l2, int l3)
 {
   if (fabs(c1) + fabs(c2) == 0.0) {
     return;
@@ -53,19 +106,23 @@ void Givens(Matrix<double> &b, Matrix<double> &q, double &c1, double &c2, int l1
   double s1 = c1 / sn;
   double s2 = c2 / sn;
 
-  for (int k = 1; k <= q.NumColumns(); k++) {
+  qRows.Merge(l1, l2);
+  for (int k = qRows.first[l1]; k <= qRows.last[l1]; k++) {
     double sv1 = q(l1, k);
     double sv2 = q(l2, k);
     q(l1, k) = s1 * sv1 + s2 * sv2;
     q(l2, k) = -s2 * sv1 + s1 * sv2;
   }
 
-  for (int k = l3; k <= b.NumColumns(); k++) {
+  bRows.Merge(l1, l2);
+  for (int k = std::max(l3, bRows.first[l1]); k <= bRows.last[l1]; k++) {
     double sv1 = b(l1, k);
     double sv2 = b(l2, k);
     b(l1, k) = s1 * sv1 + s2 * sv2;
     b(l2, k) = -s2 * sv1 + s1 * sv2;
   }
+  // Columns up to l3 - 1 of row l2 have now been eliminated
+  bRows.first[l2] = std::max(bRows.first[l2], l3);
 
   c1 = sn;
   c2 = 0.0;
@@ -73,14 +130,58 @@ void Givens(Matrix<double> &b, Matrix<double> &q, double &c1, double &c2, int l1
 
 void QRDecomp(Matrix<double> &b, Matrix<double> &q)
 {
+  RowExtents bRows, qRows;
+  bRows.Scan(b);
+  qRows.Identity(q.NumRows());
   q.MakeIdent();
   for (int m = 1; m <= b.NumColumns(); m++) {
     for (int k = m + 1; k <= b.NumRows(); k++) {
-      Givens(b, q, b(m, m), b(k, m), m, k, m + 1);
+      // A rotation with a row with no entry in column m is the identity,
+      // except when it changes the sign of a negative diagonal entry; this
+      // happens only for the first row below the diagonal.
+      if (k == m + 1 || bRows.first[k] <= m) {
+        Givens(b, q, bRows, qRows, b(m, m), b(k, m), m, k, m + 1);
+      }
     }
   }
 }
 
+//
+// Update the factorization of the transposed Jacobian b = q^T R by the
+// Broyden rank-one update J + (w - J s) s^T / (s^T s), following Allgower
+// and Georg, where w is the change in the function along the step s.
+// This costs O(n^2) operations, as against O(n^3) for QRDecomp.
+//
+void BroydenUpdate(Matrix<double> &b, Matrix<double> &q, const Vector<double> &s,
+                   const Vector<double> &w)
+{
+  RowExtents bRows, qRows;
+  bRows.Full(b.NumRows(), b.NumColumns());
+  qRows.Full(q.NumRows(), q.NumColumns());
+
+  // The updated b is q^T (R + z d^T), with z = q s / (s^T s) and d = w - J s,
+  // where J s = R^T q s
+  Vector<double> z(q * s);
+  Vector<double> d(w);
+  for (int k = 1; k <= b.NumColumns(); k++) {
+    for (int l = 1; l <= k; l++) {
+      d[k] -= b(l, k) * z[l];
+    }
+  }
+  z *= 1.0 / s.NormSquared();
+  // Reduce z to a multiple of the first unit vector; this makes R upper Hessenberg
+  for (int k = b.NumRows() - 1; k >= 1; k--) {
+    Givens(b, q, bRows, qRows, z[k], z[k + 1], k, k + 1, k);
+  }
+  for (int k = 1; k <= b.NumColumns(); k++) {
+    b(1, k) += z[1] * d[k];
+  }
+  // Restore R to upper triangular form
+  for (int k = 1; k <= b.NumColumns(); k++) {
+    Givens(b, q, bRows, qRows, b(k, k), b(k + 1, k), k, k + 1, k + 1);
+  }
+}
+
 void NewtonStep(Matrix<double> &q, Matrix<double> &b, Vector<double> &u, Vector<double> &y,
                 double &d)
 {
@@ -133,6 +234,11 @@ void PathTracer::TracePath(
   const double c_hmin = 1.0e-8;  // minimal stepsize
   const int c_maxIter = 100;     // maximum iterations in corrector
 
+  // Maximum corrector iterations using an updated Jacobian before it is evaluated afresh
+  const int c_maxUpdatedIter = 2;
+  // Maximum steps using updated Jacobians before the orientation is confirmed
+  const size_t c_maxUpdatedSteps = 10;
+
   bool newton = false;             // using Newton steplength (for zero-finding)
   const double c_pert = 0.0000001; // The size of perturbation to apply to avoid bifurcation traps
   double pert = 0.0;               // The current version of the perturbation being applied
@@ -141,20 +247,88 @@ void PathTracer::TracePath(
   Vector<double> u(x.Length());
   // t is current tangent at x; newT is tangent at u, which is the next point.
   Vector<double> t(x.Length()), newT(x.Length());
-  Vector<double> y(x.Length() - 1);
+  Vector<double> y(x.Length() - 1), fx(x.Length() - 1);
+  // With Broyden updates, whether the factorization used in the current step
+  // was carried over from earlier steps, rather than evaluated at the
+  // predicted point, whether the next step must evaluate it afresh, and
+  // whether the tangent t was obtained from a carried factorization
+  bool carried = false, refactor = false, tCarried = false;
   Matrix<double> b(x.Length(), x.Length() - 1);
   SquareMatrix<double> q(x.Length());
 
   p_jacobian(x, b);
   QRDecomp(b, q);
   q.GetRow(q.NumRows(), t);
+  if (m_broyden) {
+    p_function(x, fx);
+  }
   p_callback(x);
 
-  while (!p_terminate(x)) {
+  // A carried factorization does not become singular where the curve passes a
+  // bifurcation, so its tangent may keep an orientation which the tangent of
+  // the Jacobian reverses.  Points accepted using carried factorizations are
+  // therefore passed to p_callback only once the tangent of a newly evaluated
+  // Jacobian confirms the orientation.  Otherwise, the trace returns to the
+  // last confirmed point, and follows the curve from there with newly
+  // evaluated Jacobians for as far as it had travelled unconfirmed.
+  std::list<Vector<double>> pending;
+  Vector<double> xConfirmed(x), tConfirmed(t);
+  double hConfirmed = h, pertConfirmed = pert, pertCountdownConfirmed = pert_countdown;
+  bool newtonConfirmed = newton;
+  double fresh_countdown = 0.0; // How much longer (in arclength) to evaluate afresh
+
+  auto confirm = [&]() {
+    for (const auto &point : pending) {
+      p_callback(point);
+    }
+    pending.clear();
+    xConfirmed = x;
+    tConfirmed = t;
+    hConfirmed = h;
+    pertConfirmed = pert;
+    pertCountdownConfirmed = pert_countdown;
+    newtonConfirmed = newton;
+    tCarried = false;
+  };
+
+  // Checks the orientation of t against the Jacobian at x, confirming the
+  // pending points if it agrees and returning to the last confirmed point if not.
+  // Returns true if the orientation was confirmed.
+  auto checkOrientation = [&]() -> bool {
+    if (!tCarried) {
+      return true;
+    }
+    p_jacobian(x, b);
+    QRDecomp(b, q);
+    q.GetRow(q.NumRows(), newT);
+    carried = false;
+    refactor = true;
+    if (t * newT > 0.0) {
+      confirm();
+      return true;
+    }
+    fresh_countdown = std::sqrt((x - xConfirmed).NormSquared());
+    pending.clear();
+    x = xConfirmed;
+    t = tConfirmed;
+    h = hConfirmed;
+    pert = pertConfirmed;
+    pert_countdown = pertCountdownConfirmed;
+    newton = newtonConfirmed;
+    tCarried = false;
+    return false;
+  };
+
+  // A trace which would terminate at an unconfirmed point returns to the last
+  // confirmed point instead, if the orientation there is not confirmed
+  while (!p_terminate(x) || !checkOrientation()) {
     bool accept = true;
 
     if (fabs(h) <= c_hmin) {
-      return;
+      if (checkOrientation()) {
+        return;
+      }
+      continue;
     }
 
     // Predictor step
@@ -163,15 +337,30 @@ void PathTracer::TracePath(
     }
 
     double decel = 1.0 / m_maxDecel; // initialize deceleration factor
-    p_jacobian(u, b);
-    QRDecomp(b, q);
+    // Whether y already holds the function evaluated at u
+    bool evaluated = false;
+    if (!m_broyden || refactor || fresh_countdown > 0.0) {
+      p_jacobian(u, b);
+      QRDecomp(b, q);
+      carried = refactor = false;
+    }
+    else {
+      // Carry over the factorization, updated along the predictor step
+      p_function(u, y);
+      BroydenUpdate(b, q, u - x, y - fx);
+      carried = evaluated = true;
+    }
 
     int iter = 1;
     double disto = 0.0;
+    bool returned = false; // whether the trace returned to the last confirmed point
     while (true) {
       double dist;
 
-      p_function(u, y);
+      if (!evaluated) {
+        p_function(u, y);
+      }
+      evaluated = false;
       y[1] += pert;
       NewtonStep(q, b, u, y, dist);
 
@@ -197,14 +386,34 @@ void PathTracer::TracePath(
       disto = dist;
       iter++;
       if (iter > c_maxIter) {
-        return;
+        if (checkOrientation()) {
+          return;
+        }
+        returned = true;
+        break;
       }
     }
+    if (returned) {
+      continue;
+    }
 
     // Obtain the tangent at the next step
     q.GetRow(q.NumRows(), newT);
     double omega_flip = (t * newT < 0.0) ? -1.0 : 1.0;
 
+    if ((!accept || omega_flip == -1.0) && carried) {
+      // The factorization may have drifted from the Jacobian; retry the
+      // step with a newly evaluated Jacobian before concluding the step
+      // is too long or a bifurcation has been passed
+      refactor = true;
+      continue;
+    }
+
+    if (omega_flip == -1.0 && !checkOrientation()) {
+      // The bifurcation was passed in the unconfirmed steps
+      continue;
+    }
+
     if (omega_flip == -1.0) {
       // The orientation of the curve has changed, indicating a bifurcation.
       // Switch on perturbation and attempt to continue following the branch that
@@ -219,11 +428,19 @@ void PathTracer::TracePath(
     if (!accept) {
       h /= m_maxDecel; // PC not accepted; change stepsize and retry
       if (fabs(h) <= c_hmin) {
-        return;
+        if (checkOrientation()) {
+          return;
+        }
       }
       continue;
     }
 
+    if (carried && iter > c_maxUpdatedIter) {
+      // Contraction of the corrector has degraded; evaluate the Jacobian
+      // afresh at the next step
+      refactor = true;
+    }
+
     // Determine new stepsize
     decel = std::min(decel, m_maxDecel);
 
@@ -249,7 +466,10 @@ void PathTracer::TracePath(
     // PC step was successful; update and iterate
     x = u;
     t = newT;
-    p_callback(x);
+    if (m_broyden) {
+      p_function(x, fx);
+    }
+    fresh_countdown = std::max(fresh_countdown - abs(h), 0.0);
 
     if (pert_countdown > 0.0) {
       // If we are currently perturbing in the neighborhood of a bifurcation, check to see
@@ -260,6 +480,20 @@ void PathTracer::TracePath(
         pert_countdown = 0.0;
       }
     }
+
+    if (carried) {
+      pending.push_back(x);
+      tCarried = true;
+      if (pending.size() >= c_maxUpdatedSteps) {
+        refactor = true;
+      }
+    }
+    else {
+      // The tangent of the Jacobian at x has the orientation of the tangent
+      // at the previous point
+      confirm();
+      p_callback(x);
+    }
   }
 }
 
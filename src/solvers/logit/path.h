@@ -65,7 +65,7 @@ inline void NullCallbackFunction(const Vector<double> &) {}
 //
 class PathTracer {
 public:
-  PathTracer() : m_maxDecel(1.1), m_hStart(0.03) {}
+  PathTracer() : m_maxDecel(1.1), m_hStart(0.03), m_broyden(false) {}
   virtual ~PathTracer() = default;
 
   void SetMaxDecel(double p_maxDecel) { m_maxDecel = p_maxDecel; }
@@ -74,6 +74,12 @@ public:
   void SetStepsize(double p_hStart) { m_hStart = p_hStart; }
   double GetStepsize() const { return m_hStart; }
 
+  // If set, the factorization of the Jacobian is carried across steps and
+  // refreshed by Broyden updates; the Jacobian is evaluated afresh only
+  // when the corrector is slow to converge or fails.
+  void SetBroydenUpdates(bool p_broyden) { m_broyden = p_broyden; }
+  bool GetBroydenUpdates() const { return m_broyden; }
+
   void
   TracePath(std::function<void(const Vector<double> &, Vector<double> &)> p_function,
             std::function<void(const Vector<double> &, Matrix<double> &)> p_jacobian,
@@ -84,6 +90,7 @@ public:
 
 private:
   double m_maxDecel, m_hStart;
+  bool m_broyden;
 };
 
 } // end namespace Gambit
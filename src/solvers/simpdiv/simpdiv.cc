@@ -35,6 +35,26 @@ inline GameStrategy GetStrategy(const Game &game, int pl, int st)
   return game->GetPlayer(pl)->GetStrategies()[st];
 }
 
+/// Returns the probability of strategy st of player pl.  The profile is read through
+/// a const reference, so that its cached strategy values are not discarded.
+inline const Rational &GetProb(const MixedStrategyProfile<Rational> &y, int pl, int st)
+{
+  return y[GetStrategy(y.GetGame(), pl, st)];
+}
+
+/// Moves probability p_amount from strategy p_from to strategy p_to of player pl.
+/// This keeps the profile's cached strategy values, updating them incrementally.
+void ShiftProb(MixedStrategyProfile<Rational> &y, int pl, int p_from, int p_to,
+               const Rational &p_amount)
+{
+  GamePlayer player = y.GetGame()->GetPlayer(pl);
+  Vector<Rational> delta(player->NumStrategies());
+  delta = Rational(0);
+  delta[p_from] -= p_amount;
+  delta[p_to] += p_amount;
+  y.IncrementStrategyProbs(player, delta);
+}
+
 class NashSimpdivStrategySolver::State {
 public:
   int m_leashLength;
@@ -42,7 +62,7 @@ public:
   Rational d, pay, maxz, bestz;
 
   State(int p_leashLength) : m_leashLength(p_leashLength), bestz(1.0e30) {}
-  Rational getlabel(MixedStrategyProfile<Rational> &yy, Array<int> &, PVector<Rational> &);
+  Rational getlabel(const MixedStrategyProfile<Rational> &yy, Array<int> &, PVector<Rational> &);
 
   /* Check whether the distance p_dist is "too far" given the leash length, if set. */
   bool CheckLeashOK(const Rational &p_dist) const
@@ -176,8 +196,8 @@ step3:
   getY(state, y, v, U, TT, ab, pi, ii);
 
   /* case3a */
-  if (i == 1 && (y[GetStrategy(game, j, k)] <= Rational(0) ||
-                 !state.CheckLeashOK(v(j, k) - y[GetStrategy(game, j, k)]))) {
+  if (i == 1 && (GetProb(y, j, k) <= Rational(0) ||
+                 !state.CheckLeashOK(v(j, k) - GetProb(y, j, k)))) {
     for (hh = 1, tot = 0; hh <= nstrats[j]; hh++) {
       if (TT(j, hh) == 1 || U(j, hh) == 1) {
         tot++;
@@ -196,14 +216,14 @@ step3:
   }
   /* case3b */
   else if (i >= 2 && i <= state.t &&
-           (y[GetStrategy(game, j, k)] <= Rational(0) ||
-            !state.CheckLeashOK(v(j, k) - y[GetStrategy(game, j, k)]))) {
+           (GetProb(y, j, k) <= Rational(0) ||
+            !state.CheckLeashOK(v(j, k) - GetProb(y, j, k)))) {
     goto step4;
   }
   /* case3c */
   else if (i == state.t + 1 && ab(j, kk) == Rational(0)) {
-    if (y[GetStrategy(game, j, h)] <= Rational(0) ||
-        !state.CheckLeashOK(v(j, h) - y[GetStrategy(game, j, h)])) {
+    if (GetProb(y, j, h) <= Rational(0) ||
+        !state.CheckLeashOK(v(j, h) - GetProb(y, j, h))) {
       goto step4;
     }
     else {
@@ -240,8 +260,7 @@ step3:
       j = pi(state.t, 1);
       h = pi(state.t, 2);
       hh = get_b(j, h, nstrats[j], U);
-      y[GetStrategy(game, j, h)] -= state.d;
-      y[GetStrategy(game, j, hh)] += state.d;
+      ShiftProb(y, j, h, hh, state.d);
     }
     update(state, pi, labels, ab, U, j, i);
   }
@@ -252,8 +271,8 @@ step4:
   j = pi(i - 1, 1);
   h = pi(i - 1, 2);
   TT(j, h) = 0;
-  if (y[GetStrategy(game, j, h)] <= Rational(0) ||
-      !state.CheckLeashOK(v(j, h) - y[GetStrategy(game, j, h)])) {
+  if (GetProb(y, j, h) <= Rational(0) ||
+      !state.CheckLeashOK(v(j, h) - GetProb(y, j, h))) {
     U(j, h) = 1;
   }
   labels.RotateUp(i, state.t + 1);
@@ -275,8 +294,7 @@ step5:
   jj = pi(1, 1);
   hh = pi(1, 2);
   kk = get_b(jj, hh, nstrats[jj], U);
-  y[GetStrategy(game, jj, hh)] -= state.d;
-  y[GetStrategy(game, jj, kk)] += state.d;
+  ShiftProb(y, jj, hh, kk, state.d);
 
   k = get_c(j, h, nstrats[j], U);
   kk = 1;
@@ -360,19 +378,46 @@ void NashSimpdivStrategySolver::getY(State &state, MixedStrategyProfile<Rational
                                      const PVector<int> &TT, const PVector<Rational> &ab,
                                      const RectArray<int> &pi, int k) const
 {
-  x = v;
+  PVector<Rational> y(v);
   for (size_t j = 1; j <= x.GetGame()->NumPlayers(); j++) {
     GamePlayer player = x.GetGame()->GetPlayer(j);
     for (size_t h = 1; h <= player->GetStrategies().size(); h++) {
       if (TT(j, h) == 1 || U(j, h) == 1) {
-        x[player->GetStrategies()[h]] += state.d * ab(j, h);
+        y(j, h) += state.d * ab(j, h);
         int hh = (h > 1) ? h - 1 : player->GetStrategies().size();
-        x[player->GetStrategies()[hh]] -= state.d * ab(j, h);
+        y(j, hh) -= state.d * ab(j, h);
       }
     }
   }
   for (int i = 2; i <= k; i++) {
-    getnexty(state, x, pi, U, i - 1);
+    int j = pi(i - 1, 1);
+    int h = pi(i - 1, 2);
+    int hh = get_b(j, h, x.GetGame()->GetPlayer(j)->NumStrategies(), U);
+    y(j, h) += state.d;
+    y(j, hh) -= state.d;
+  }
+
+  // Successive points usually differ in the mixture of a single player; in that
+  // case the profile's cached strategy values are updated rather than recomputed.
+  GamePlayer changed;
+  for (auto player : x.GetGame()->GetPlayers()) {
+    for (int h = 1; h <= player->NumStrategies(); h++) {
+      if (y(player->GetNumber(), h) != GetProb(x, player->GetNumber(), h)) {
+        if (changed) {
+          x = y;
+          return;
+        }
+        changed = player;
+        break;
+      }
+    }
+  }
+  if (changed) {
+    Vector<Rational> delta = y.GetRow(changed->GetNumber());
+    for (int h = 1; h <= delta.Length(); h++) {
+      delta[h] -= GetProb(x, changed->GetNumber(), h);
+    }
+    x.IncrementStrategyProbs(changed, delta);
   }
 }
 
@@ -381,11 +426,9 @@ void NashSimpdivStrategySolver::getnexty(State &state, MixedStrategyProfile<Rati
                                          int i) const
 {
   int j = pi(i, 1);
-  GamePlayer player = x.GetGame()->GetPlayer(j);
   int h = pi(i, 2);
-  x[player->GetStrategies()[h]] += state.d;
-  int hh = get_b(j, h, player->GetStrategies().size(), U);
-  x[player->GetStrategies()[hh]] -= state.d;
+  int hh = get_b(j, h, x.GetGame()->GetPlayer(j)->NumStrategies(), U);
+  ShiftProb(x, j, hh, h, state.d);
 }
 
 int NashSimpdivStrategySolver::get_b(int j, int h, int nstrats, const PVector<int> &U) const
@@ -406,20 +449,21 @@ int NashSimpdivStrategySolver::get_c(int j, int h, int nstrats, const PVector<in
   return (hh > nstrats) ? 1 : hh;
 }
 
-Rational NashSimpdivStrategySolver::State::getlabel(MixedStrategyProfile<Rational> &yy,
+Rational NashSimpdivStrategySolver::State::getlabel(const MixedStrategyProfile<Rational> &yy,
                                                     Array<int> &ylabel, PVector<Rational> &besty)
 {
   Rational maxz(-1000000);
   ylabel[1] = 1;
   ylabel[2] = 1;
 
+  PVector<Rational> values = yy.GetStrategyValues();
   for (int i = 1; i <= yy.GetGame()->NumPlayers(); i++) {
     GamePlayer player = yy.GetGame()->GetPlayer(i);
     Rational payoff(0);
     Rational maxval(-1000000);
     int jj = 0;
     for (size_t j = 1; j <= player->GetStrategies().size(); j++) {
-      pay = yy.GetPayoff(player->GetStrategies()[j]);
+      pay = values(i, j);
       payoff += yy[player->GetStrategies()[j]] * pay;
       if (pay > maxval) {
         maxval = pay;
@@ -49,6 +49,8 @@ void PrintHelp(char *progname)
   std::cerr << "  -S               report equilibria in strategies even for extensive games\n";
   std::cerr << "  -A               compute agent form equilibria\n";
   std::cerr << "  -P               find only subgame-perfect equilibria\n";
+  std::cerr << "  -t THREADS       number of threads to use on strategic games (default 1;\n";
+  std::cerr << "                   0 uses one per hardware thread)\n";
   std::cerr << "  -h, --help       print this help message\n";
   std::cerr << "  -q               quiet mode (suppresses banner)\n";
   std::cerr << "  -v, --version    print version information\n";
@@ -60,12 +62,13 @@ int main(int argc, char *argv[])
   opterr = 0;
   bool quiet = false, reportStrategic = false, solveAgent = false, bySubgames = false;
   bool printDetail = false;
+  int numThreads = 1;
 
   int long_opt_index = 0;
   struct option long_options[] = {
       {"help", 0, nullptr, 'h'}, {"version", 0, nullptr, 'v'}, {nullptr, 0, nullptr, 0}};
   int c;
-  while ((c = getopt_long(argc, argv, "DvhqASP", long_options, &long_opt_index)) != -1) {
+  while ((c = getopt_long(argc, argv, "DvhqASPt:", long_options, &long_opt_index)) != -1) {
     switch (c) {
     case 'v':
       PrintBanner(std::cerr);
@@ -82,6 +85,9 @@ int main(int argc, char *argv[])
     case 'P':
       bySubgames = true;
       break;
+    case 't':
+      numThreads = atoi(optarg);
+      break;
     case 'h':
       PrintHelp(argv[0]);
       break;
@@ -145,7 +151,8 @@ int main(int argc, char *argv[])
           stage = std::make_shared<EnumPureAgentSolver>();
         }
         else {
-          std::shared_ptr<StrategySolver<Rational>> substage(new EnumPureStrategySolver());
+          std::shared_ptr<StrategySolver<Rational>> substage(
+              new EnumPureStrategySolver(nullptr, numThreads));
           stage = std::make_shared<BehavViaStrategySolver<Rational>>(substage);
         }
         SubgameBehavSolver<Rational> algorithm(stage, renderer);
@@ -157,13 +164,13 @@ int main(int argc, char *argv[])
           algorithm.Solve(game);
         }
         else {
-          EnumPureStrategySolver algorithm(renderer);
+          EnumPureStrategySolver algorithm(renderer, numThreads);
           algorithm.Solve(game);
         }
       }
     }
     else {
-      EnumPureStrategySolver algorithm(renderer);
+      EnumPureStrategySolver algorithm(renderer, numThreads);
       algorithm.Solve(game);
     }
     return 0;
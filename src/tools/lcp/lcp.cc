@@ -54,6 +54,8 @@ void PrintHelp(char *progname)
   std::cerr << "                   (default is to find all accessible equilbria\n";
   std::cerr << "  -r DEPTH         terminate recursion at DEPTH\n";
   std::cerr << "                   (only if number of equilibria sought is not 1)\n";
+  std::cerr << "  -t THREADS       number of threads to use on strategic games (default 1;\n";
+  std::cerr << "                   0 uses one per hardware thread)\n";
   std::cerr << "  -D               print detailed information about equilibria\n";
   std::cerr << "  -h, --help       print this help message\n";
   std::cerr << "  -q               quiet mode (suppresses banner)\n";
@@ -66,12 +68,12 @@ int main(int argc, char *argv[])
   int c;
   bool useFloat = false, useStrategic = false, bySubgames = false, quiet = false;
   bool printDetail = false;
-  int numDecimals = 6, stopAfter = 0, maxDepth = 0;
+  int numDecimals = 6, stopAfter = 0, maxDepth = 0, numThreads = 1;
 
   int long_opt_index = 0;
   struct option long_options[] = {
       {"help", 0, nullptr, 'h'}, {"version", 0, nullptr, 'v'}, {nullptr, 0, nullptr, 0}};
-  while ((c = getopt_long(argc, argv, "d:DvhqSPe:r:", long_options, &long_opt_index)) != -1) {
+  while ((c = getopt_long(argc, argv, "d:DvhqSPe:r:t:", long_options, &long_opt_index)) != -1) {
     switch (c) {
     case 'v':
       PrintBanner(std::cerr);
@@ -95,6 +97,9 @@ int main(int argc, char *argv[])
     case 'r':
       maxDepth = atoi(optarg);
       break;
+    case 't':
+      numThreads = atoi(optarg);
+      break;
     case 'S':
       useStrategic = true;
       break;
@@ -142,7 +147,7 @@ int main(int argc, char *argv[])
         else {
           renderer = std::make_shared<MixedStrategyCSVRenderer<double>>(std::cout, numDecimals);
         }
-        NashLcpStrategySolver<double> algorithm(stopAfter, maxDepth, renderer);
+        NashLcpStrategySolver<double> algorithm(stopAfter, maxDepth, renderer, numThreads);
         algorithm.Solve(game);
       }
       else {
@@ -153,7 +158,7 @@ int main(int argc, char *argv[])
         else {
           renderer = std::make_shared<MixedStrategyCSVRenderer<Rational>>(std::cout);
         }
-        NashLcpStrategySolver<Rational> algorithm(stopAfter, maxDepth, renderer);
+        NashLcpStrategySolver<Rational> algorithm(stopAfter, maxDepth, renderer, numThreads);
         algorithm.Solve(game);
       }
     }
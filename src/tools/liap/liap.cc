@@ -25,6 +25,7 @@
 #include <cstdlib>
 #include <getopt.h>
 #include "gambit.h"
+#include "games/gametable.h"
 #include "solvers/liap/liap.h"
 
 using namespace Gambit;
@@ -52,6 +53,8 @@ void PrintHelp(char *progname)
   std::cerr << "  -m MAXREGRET     maximum regret acceptable as a proportion of range of\n";
   std::cerr << "                   payoffs in the game\n";
   std::cerr << "  -s FILE          file containing starting points\n";
+  std::cerr << "  -t THREADS       number of threads to use evaluating strategic games\n";
+  std::cerr << "                   (default 1; 0 uses one per hardware thread)\n";
   std::cerr << "  -q               quiet mode (suppresses banner)\n";
   std::cerr << "  -V, --verbose    verbose mode (shows intermediate output)\n";
   std::cerr << "                   (default is to only show equilibria)\n";
@@ -132,6 +135,7 @@ int main(int argc, char *argv[])
   int numTries = 10;
   int maxitsN = 1000;
   int numDecimals = 6;
+  int numThreads = 1;
   double maxregret = 1.0e-4;
   double tolN = 1.0e-10;
   std::string startFile;
@@ -142,7 +146,7 @@ int main(int argc, char *argv[])
                                   {"verbose", 0, nullptr, 'V'},
                                   {nullptr, 0, nullptr, 0}};
   int c;
-  while ((c = getopt_long(argc, argv, "d:n:i:s:m:hqVvS", long_options, &long_opt_index)) != -1) {
+  while ((c = getopt_long(argc, argv, "d:n:i:s:m:t:hqVvS", long_options, &long_opt_index)) != -1) {
     switch (c) {
     case 'v':
       PrintBanner(std::cerr);
@@ -159,6 +163,9 @@ int main(int argc, char *argv[])
     case 's':
       startFile = optarg;
       break;
+    case 't':
+      numThreads = atoi(optarg);
+      break;
     case 'h':
       PrintHelp(argv[0]);
       break;
@@ -203,6 +210,9 @@ int main(int argc, char *argv[])
 
   try {
     Game game = ReadGame(*input_stream);
+    if (auto *table = dynamic_cast<GameTableRep *>(game.operator->())) {
+      table->SetNumThreads(numThreads);
+    }
     if (!game->IsTree() || useStrategic) {
       List<MixedStrategyProfile<double>> starts;
       if (!startFile.empty()) {
@@ -50,6 +50,7 @@ void PrintHelp(char *progname)
   std::cerr << "  -a ACCEL         maximum acceleration (default is 1.1)\n";
   std::cerr << "  -m MAXREGRET     maximum regret acceptable as a proportion of range of\n";
   std::cerr << "                   payoffs in the game\n";
+  std::cerr << "  -b               update the Jacobian by Broyden's method between steps\n";
   std::cerr << "  -l LAMBDA        compute QRE at `lambda` accurately\n";
   std::cerr << "  -L FILE          compute maximum likelihood estimates;\n";
   std::cerr << "                   read strategy frequencies from FILE\n";
@@ -109,7 +110,7 @@ int main(int argc, char *argv[])
 {
   opterr = 0;
 
-  bool quiet = false, useStrategic = false;
+  bool quiet = false, useStrategic = false, useBroyden = false;
   double maxLambda = 1000000.0;
   double maxregret = 1.0e-8;
   std::string mleFile;
@@ -123,7 +124,7 @@ int main(int argc, char *argv[])
   struct option long_options[] = {
       {"help", 0, nullptr, 'h'}, {"version", 0, nullptr, 'v'}, {nullptr, 0, nullptr, 0}};
   int c;
-  while ((c = getopt_long(argc, argv, "d:s:a:m:vqehSL:p:l:", long_options, &long_opt_index)) !=
+  while ((c = getopt_long(argc, argv, "d:s:a:m:vqehbSL:p:l:", long_options, &long_opt_index)) !=
          -1) {
     switch (c) {
     case 'v':
@@ -150,6 +151,9 @@ int main(int argc, char *argv[])
     case 'h':
       PrintHelp(argv[0]);
       break;
+    case 'b':
+      useBroyden = true;
+      break;
     case 'S':
       useStrategic = true;
       break;
@@ -206,8 +210,8 @@ int main(int argc, char *argv[])
           PrintProfile(std::cout, decimals, p);
         }
       };
-      auto result =
-          LogitStrategyEstimate(frequencies, maxLambda, 1.0, false, hStart, maxDecel, printer);
+      auto result = LogitStrategyEstimate(frequencies, maxLambda, 1.0, false, hStart, maxDecel,
+                                          printer, useBroyden);
       PrintProfile(std::cout, decimals, result);
       return 0;
     }
@@ -220,14 +224,15 @@ int main(int argc, char *argv[])
       };
       LogitQREMixedStrategyProfile start(game);
       if (!targetLambda.empty()) {
-        auto result =
-            LogitStrategySolveLambda(start, targetLambda, 1.0, hStart, maxDecel, printer);
+        auto result = LogitStrategySolveLambda(start, targetLambda, 1.0, hStart, maxDecel,
+                                               printer, useBroyden);
         for (auto &profile : result) {
           PrintProfile(std::cout, decimals, profile);
         }
       }
       else {
-        auto result = LogitStrategySolve(start, maxregret, 1.0, hStart, maxDecel, printer);
+        auto result =
+            LogitStrategySolve(start, maxregret, 1.0, hStart, maxDecel, printer, useBroyden);
         PrintProfile(std::cout, decimals, result.back(), true);
       }
     }
@@ -239,14 +244,15 @@ int main(int argc, char *argv[])
       };
       LogitQREMixedBehaviorProfile start(game);
       if (!targetLambda.empty()) {
-        auto result =
-            LogitBehaviorSolveLambda(start, targetLambda, 1.0, hStart, maxDecel, printer);
+        auto result = LogitBehaviorSolveLambda(start, targetLambda, 1.0, hStart, maxDecel,
+                                               printer, useBroyden);
         for (auto &profile : result) {
           PrintProfile(std::cout, decimals, profile);
         }
       }
       else {
-        auto result = LogitBehaviorSolve(start, maxregret, 1.0, hStart, maxDecel, printer);
+        auto result =
+            LogitBehaviorSolve(start, maxregret, 1.0, hStart, maxDecel, printer, useBroyden);
         PrintProfile(std::cout, decimals, result.back(), true);
       }
     }
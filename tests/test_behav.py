@@ -1237,3 +1237,37 @@ def test_tree_representation_error(game: gbt.Game, rational_flag: bool, data: li
     """
     with pytest.raises(gbt.UndefinedOperationError):
         game.mixed_behavior_profile(rational=rational_flag, data=data)
+
+
+@pytest.mark.parametrize(
+    "game,action_probs",
+    [(games.create_mixed_behav_game_efg(), ["1", "0", "1", "0", "1", "0"]),
+     (games.create_mixed_behav_game_efg(), ["1", "0", "0", "1", "0", "1"]),
+     (games.create_mixed_behav_game_efg(), ["0", "1", "1", "0", "0", "1"]),
+     (games.create_mixed_behav_game_efg(), ["0", "1", "0", "1", "1", "0"]),
+     (games.create_mixed_behav_game_efg(), ["2/5", "3/5", "1/2", "1/2", "1/3", "2/3"]),
+     (games.create_myerson_2_card_poker_efg(), ["1", "0", "1/3", "2/3", "2/3", "1/3"]),
+     ]
+)
+def test_equilibrium_values(game: gbt.Game, action_probs: list):
+    """Test that at a known equilibrium no information set has regret, the actions played
+    have the value of their information set, and payoffs agree with the strategic form,
+    both before and after a chance move with a single action is inserted at the root.
+    """
+    for _ in range(2):
+        profile = game.mixed_behavior_profile(rational=True)
+        _set_action_probs(profile, action_probs, True)
+        for infoset in game.infosets:
+            if infoset.is_chance:
+                continue
+            assert profile.infoset_regret(infoset) == 0
+            for action in infoset.actions:
+                if profile[action] > 0:
+                    assert profile.action_regret(action) == 0
+                    assert profile.action_value(action) == profile.infoset_value(infoset)
+        assert profile.max_regret() == 0
+        strategy_profile = profile.as_strategy()
+        for player in game.players:
+            assert profile.payoff(player) == strategy_profile.payoff(player)
+            assert profile.node_value(player, game.root) == profile.payoff(player)
+        game.insert_move(game.root, game.players.chance, 1)
@@ -69,6 +69,80 @@ def test_game_is_not_perfect_recall():
     assert not game.is_perfect_recall
 
 
+def _create_three_move_game(player: str) -> gbt.Game:
+    """Create a game in which Alice moves first, and then `player` moves in one information
+    set at all three of her choices.  The members are added in a different order from the
+    order of the nodes in the tree, with the earliest node added last.
+    """
+    game = gbt.Game.new_tree(["Alice", "Bob"])
+    game.append_move(game.root, "Alice", ["a", "b", "c"])
+    game.append_move(game.root.children[1], player, ["l", "r"])
+    game.append_infoset(game.root.children[2], game.root.children[1].infoset)
+    game.append_infoset(game.root.children[0], game.root.children[1].infoset)
+    return game
+
+
+def test_game_infoset_members_sorted():
+    game = _create_three_move_game("Bob")
+    assert list(game.players["Bob"].infosets[0].members) == list(game.root.children)
+
+
+def test_game_infosets_sorted():
+    game = gbt.Game.new_tree(["Alice", "Bob"])
+    game.append_move(game.root, "Alice", ["a", "b", "c"])
+    for child in [2, 1, 0]:
+        game.append_move(game.root.children[child], "Bob", ["l", "r"])
+    infosets = game.players["Bob"].infosets
+    assert [infoset.members[0] for infoset in infosets] == list(game.root.children)
+    assert [infoset.number for infoset in infosets] == [0, 1, 2]
+
+
+def test_game_is_perfect_recall_members_out_of_order():
+    assert _create_three_move_game("Bob").is_perfect_recall
+
+
+def test_game_is_not_perfect_recall_members_out_of_order():
+    assert not _create_three_move_game("Alice").is_perfect_recall
+
+
+def test_game_is_not_perfect_recall_after_edit():
+    game = games.read_from_file("perfect_recall.efg")
+    assert game.is_perfect_recall
+    game.append_infoset(game.root.children[0], game.root.infoset)
+    assert not game.is_perfect_recall
+    game.delete_tree(game.root.children[0])
+    assert game.is_perfect_recall
+
+
+def test_game_subgame_roots():
+    assert games.read_from_file("perfect_recall.efg").root.is_subgame_root
+    # The root is in the same information set as its child
+    game = games.read_from_file("not_perfect_recall.efg")
+    assert not game.root.is_subgame_root
+    assert not game.root.children[0].is_subgame_root
+    game = _create_three_move_game("Bob")
+    assert game.root.is_subgame_root
+    assert not any(child.is_subgame_root for child in game.root.children)
+    game.leave_infoset(game.root.children[0])
+    assert game.root.children[0].is_subgame_root
+    assert not game.root.children[1].is_subgame_root
+
+
+def test_game_node_is_successor_of():
+    game = _create_three_move_game("Bob")
+    for i, child in enumerate(game.root.children):
+        assert child.is_successor_of(game.root)
+        assert not game.root.is_successor_of(child)
+        for grandchild in child.children:
+            assert grandchild.is_successor_of(game.root)
+            assert grandchild.is_successor_of(child)
+            assert not grandchild.is_successor_of(game.root.children[(i + 1) % 3])
+        # Check again after an edit, before anything else is computed on the tree
+        game.append_move(child.children[0], "Alice", ["x"])
+        assert child.children[0].children[0].is_successor_of(child)
+        assert not child.children[0].children[0].is_successor_of(child.children[1])
+
+
 def test_getting_payoff_by_label_string():
     game = games.read_from_file("sample_extensive_game.efg")
     assert game[[0, 0]]["Player 1"] == 2
@@ -94,6 +94,27 @@ def test_normalize(game, profile_data, expected_data, rational_flag):
     )
 
 
+@pytest.mark.parametrize("rational_flag", [False, True])
+def test_normalize_after_payoffs(rational_flag: bool):
+    """Test that the payoffs and strategy values of a normalized profile on a tree are
+    those of the normalized probabilities, when payoffs of the original profile were
+    computed first.
+    """
+    game = games.read_from_file("poker.efg")
+    profile = game.mixed_strategy_profile(data=[[3, 1, 0, 0], [1, 3]], rational=rational_flag)
+    profile.payoff(game.players[0])
+    normalized = profile.normalize()
+    expected = game.mixed_strategy_profile(
+        data=[["3/4", "1/4", "0", "0"], ["1/4", "3/4"]] if rational_flag else
+        [[0.75, 0.25, 0.0, 0.0], [0.25, 0.75]],
+        rational=rational_flag
+    )
+    for player in game.players:
+        assert abs(normalized.payoff(player) - expected.payoff(player)) <= TOL
+    for strategy in game.strategies:
+        assert abs(normalized.strategy_value(strategy) - expected.strategy_value(strategy)) <= TOL
+
+
 @pytest.mark.parametrize(
     "game,strategy_label,rational_flag,prob",
     [
@@ -460,6 +481,43 @@ def test_payoffs_reference(game: gbt.Game, profile_data: list, rational_flag: bo
         assert profile.payoff(player) == payoff
 
 
+@pytest.mark.parametrize(
+    "payoffs",
+    [
+     # Values around the limits of 16-bit limbs, 32 bits and 64-bit integers
+     [2**16 - 1, 2**16, -(2**16) - 1, 65537],
+     [2**32 - 1, 2**32, -(2**32) + 1, gbt.Rational(2**32 + 1, 65536)],
+     [2**63 - 1, 2**63, -(2**63), -(2**63) - 1],
+     [2**64 + 7, gbt.Rational(2**63 + 1, 3), -(2**62), gbt.Rational(-(2**65) + 3, 7)],
+     # Numerators and denominators of both signs with nonzero remainders
+     [gbt.Rational(-7, 3), gbt.Rational(-(2**33) - 1, 2**31 - 1),
+      gbt.Rational(-(2**40) - 5, 2**20 + 1), gbt.Rational(2**70 - 1, -(2**35) - 3)],
+    ]
+)
+def test_payoffs_large_rational(payoffs: list):
+    """Test payoffs and strategy values computed exactly for payoffs of various sizes
+    and signs agree with the same computations using Python's rationals.
+    """
+    game = gbt.Game.new_table([2, 2])
+    contingencies = list(product(range(2), range(2)))
+    for (i, j), payoff in zip(contingencies, payoffs):
+        game[[i, j]][game.players[0]] = payoff
+        game[[i, j]][game.players[1]] = -payoff * 3
+    for (i, j), payoff in zip(contingencies, payoffs):
+        assert game[[i, j]][game.players[0]] == payoff
+    probs = [[gbt.Rational(1, 3), gbt.Rational(2, 3)], [gbt.Rational(5, 7), gbt.Rational(2, 7)]]
+    profile = game.mixed_strategy_profile(rational=True, data=probs)
+    expected = sum(probs[0][i] * probs[1][j] * gbt.Rational(payoff)
+                   for (i, j), payoff in zip(contingencies, payoffs))
+    assert profile.payoff(game.players[0]) == expected
+    assert profile.payoff(game.players[1]) == -3 * expected
+    for i, strategy in enumerate(game.players[0].strategies):
+        assert profile.strategy_value(strategy) == sum(
+            probs[1][j] * gbt.Rational(payoff)
+            for (k, j), payoff in zip(contingencies, payoffs) if k == i
+        )
+
+
 @pytest.mark.parametrize(
     "game,profile_data,rational_flag,strategy_values",
     [
@@ -940,3 +998,30 @@ def test_profile_order_consistency(game: gbt.Game,
                                    objects_to_test: typing.Callable):
     _get_and_check_answers(game, action_probs1, action_probs2, rational_flag, func_to_test,
                            objects_to_test(game))
+
+
+@pytest.mark.parametrize(
+    "game,rational_flag",
+    [(games.create_coord_4x4_nfg(), False),
+     (games.create_coord_4x4_nfg(), True),
+     (games.create_2x2x2_nfg(), False),
+     (games.create_2x2x2_nfg(), True),
+     (games.create_myerson_2_card_poker_efg(), False),
+     (games.create_myerson_2_card_poker_efg(), True),
+     ]
+)
+def test_set_mixed_strategies_matches_fresh_profile(game: gbt.Game, rational_flag: bool):
+    """Test that values cached in a profile, which are corrected in place as each player's
+    mixed strategy is set, agree with those computed afresh for a copy of the profile.
+    """
+    profile = game.mixed_strategy_profile(rational=rational_flag)
+    profile.liap_value()
+    for i in range(250):
+        player = game.players[i % len(game.players)]
+        weights = [(7 * i + 3 * j) % 11 + 1 for j in range(len(player.strategies))]
+        probs = [gbt.Rational(w, sum(weights)) for w in weights]
+        profile[player] = probs if rational_flag else [float(p) for p in probs]
+        if rational_flag:
+            assert profile.liap_value() == profile.copy().liap_value()
+        else:
+            assert abs(profile.liap_value() - profile.copy().liap_value()) <= TOL
@@ -7,7 +7,9 @@ rigorous test suite for the algorithms across all games.
 
 import unittest
 
+import numpy as np
 import pygambit as gbt
+import pytest
 
 from . import games
 
@@ -132,6 +134,36 @@ class TestNash(unittest.TestCase):
         assert len(result.equilibria) == 1
         # gbt.nash.logit_behavior_atlambda(self.poker, 1.0)
 
+    def test_logit_strategy_broyden(self):
+        """Test logit with Broyden updates reaches the same mixed strategy equilibrium."""
+        expected = gbt.nash.logit_solve(self.poker, use_strategic=True).equilibria[0]
+        result = gbt.nash.logit_solve(self.poker, use_strategic=True, broyden=True)
+        assert len(result.equilibria) == 1
+        for strategy in self.poker.strategies:
+            assert abs(result.equilibria[0][strategy] - expected[strategy]) < 1.0e-4
+
+    def test_logit_behavior_broyden(self):
+        """Test logit with Broyden updates reaches the same mixed behavior equilibrium."""
+        expected = gbt.nash.logit_solve(self.poker, use_strategic=False).equilibria[0]
+        result = gbt.nash.logit_solve(self.poker, use_strategic=False, broyden=True)
+        assert len(result.equilibria) == 1
+        for action in self.poker.actions:
+            assert abs(result.equilibria[0][action] - expected[action]) < 1.0e-4
+
+
+def test_logit_broyden_bifurcation():
+    """Test logit with Broyden updates follows the same branch past a bifurcation.
+
+    This is Shapley's symmetric 3x3 game, in which the principal branch bifurcates.
+    """
+    a = [[0, 3, 0], [2, 2, 0], [3, 0, 1]]
+    game = gbt.Game.from_arrays(a, [list(row) for row in zip(*a)])
+    expected = gbt.nash.logit_solve(game).equilibria[0]
+    result = gbt.nash.logit_solve(game, broyden=True)
+    assert len(result.equilibria) == 1
+    for strategy in game.strategies:
+        assert abs(result.equilibria[0][strategy] - expected[strategy]) < 1.0e-4
+
 
 # def test_logit_zerochance():
 #   """Test handling zero-probability information sets when computing QRE."""
@@ -144,3 +176,192 @@ class TestNash(unittest.TestCase):
 #   g.set_outcome(g.root.children[0].children[0], win)
 #   result = gbt.nash.logit_solve(g, use_strategic=False, maxregret=0.0001)
 #   assert result.equilibria[0].max_regret() < 0.0001
+
+
+def test_logit_strategy_estimate_batch():
+    """Test estimating logit QRE for a list of frequencies matches estimating each in turn."""
+    game = games.read_from_file("poker.efg")
+    data = [game.mixed_strategy_profile(data=[[1, 2, 3, 4], [5, 6]]),
+            game.mixed_strategy_profile(data=[[10, 2, 1, 0], [3, 7]]),
+            game.mixed_strategy_profile(data=[[1, 1, 1, 1], [1, 1]])]
+    expected = [gbt.gambit._logit_strategy_estimate(profile) for profile in data]
+    for threads in [1, 2]:
+        result = gbt.gambit._logit_strategy_estimate(data, threads=threads)
+        assert len(result) == len(expected)
+        for qre, qre_expected in zip(result, expected):
+            assert qre.lam == qre_expected.lam
+            assert qre.log_like == qre_expected.log_like
+            assert list(qre) == list(qre_expected)
+    assert gbt.gambit._logit_strategy_estimate([], threads=2) == []
+
+
+def test_logit_strategy_lambda_batch():
+    """Test tracing logit QRE to lists of lambda values matches tracing to each list in turn."""
+    game = games.read_from_file("poker.efg")
+    targets = [[0.5, 1.0, 2.0], [1.5], [0.25, 3.0]]
+    expected = [gbt.gambit._logit_strategy_lambda(game, lam) for lam in targets]
+    for threads in [1, 2]:
+        result = gbt.gambit._logit_strategy_lambda(game, targets, threads=threads)
+        assert len(result) == len(expected)
+        for run, run_expected in zip(result, expected):
+            assert [qre.lam for qre in run] == [qre.lam for qre in run_expected]
+            assert [list(qre) for qre in run] == [list(qre) for qre in run_expected]
+    assert gbt.gambit._logit_strategy_lambda(game, [], threads=2) == []
+
+
+def _create_battle_of_sexes() -> gbt.Game:
+    """Create a battle of the sexes, which has two pure equilibria and one mixed."""
+    return gbt.Game.from_arrays([[2, 0], [0, 1]], [[1, 0], [0, 2]])
+
+
+BATTLE_OF_SEXES_EQUILIBRIA = [
+    [gbt.Rational(0), gbt.Rational(1), gbt.Rational(0), gbt.Rational(1)],
+    [gbt.Rational(2, 3), gbt.Rational(1, 3), gbt.Rational(1, 3), gbt.Rational(2, 3)],
+    [gbt.Rational(1), gbt.Rational(0), gbt.Rational(1), gbt.Rational(0)],
+]
+
+
+def _create_quadratic_game(n: int) -> gbt.Game:
+    """Create an n x n game with integer payoffs, in which LCP finds many equilibria."""
+    return gbt.Game.from_arrays(
+        [[(7 * i * i + 5 * j * j + i * j) % (2 * n) for j in range(n)] for i in range(n)],
+        [[(5 * j * j + 3 * i * i + 2 * i * j) % (2 * n) for j in range(n)] for i in range(n)]
+    )
+
+
+def _profile_list(profile) -> list:
+    return [profile[strategy] for strategy in profile.game.strategies]
+
+
+def test_lcp_strategy_rational_all_equilibria():
+    """Test LCP in exact arithmetic finds exactly the equilibria of a battle of the sexes."""
+    result = gbt.nash.lcp_solve(_create_battle_of_sexes(), use_strategic=True, rational=True)
+    assert sorted(_profile_list(eqm) for eqm in result.equilibria) == BATTLE_OF_SEXES_EQUILIBRIA
+
+
+def test_enummixed_strategy_rational_all_equilibria():
+    """Test enumeration of vertices in exact arithmetic finds exactly the equilibria
+    of a battle of the sexes."""
+    result = gbt.nash.enummixed_solve(_create_battle_of_sexes(), rational=True)
+    assert sorted(_profile_list(eqm) for eqm in result.equilibria) == BATTLE_OF_SEXES_EQUILIBRIA
+
+
+def test_lp_strategy_rational_zero_sum():
+    """Test LP in exact arithmetic finds the equilibrium of a weighted rock-paper-scissors."""
+    a = [[0, -1, 2], [1, 0, -1], [-2, 1, 0]]
+    game = gbt.Game.from_arrays(a, [[-x for x in row] for row in a])
+    result = gbt.nash.lp_solve(game, rational=True)
+    assert len(result.equilibria) == 1
+    probs = [gbt.Rational(1, 4), gbt.Rational(1, 2), gbt.Rational(1, 4)]
+    assert _profile_list(result.equilibria[0]) == probs + probs
+    assert result.equilibria[0].payoff(game.players[0]) == 0
+
+
+def test_lcp_strategy_double_matches_rational():
+    """Test LCP in floating point follows the same paths as in exact arithmetic."""
+    for game in [_create_battle_of_sexes(), _create_quadratic_game(8), _create_quadratic_game(9)]:
+        for max_depth in [None, 1]:
+            expected = gbt.nash.lcp_solve(game, use_strategic=True, rational=True,
+                                          max_depth=max_depth).equilibria
+            result = gbt.nash.lcp_solve(game, use_strategic=True, rational=False,
+                                        max_depth=max_depth).equilibria
+            assert len(result) == len(expected)
+            for eqm, eqm_expected in zip(result, expected):
+                for prob, prob_expected in zip(_profile_list(eqm), _profile_list(eqm_expected)):
+                    assert abs(prob - prob_expected) < 1.0e-10
+
+
+def test_lcp_strategy_threads():
+    """Test LCP following paths on several threads finds the same equilibria as on one.
+    In floating point, an equilibrium may be reached along a different path than on one
+    thread, and so with different rounding errors."""
+    for game in [games.create_coord_4x4_nfg(), _create_quadratic_game(9)]:
+        expected = sorted(_profile_list(eqm)
+                          for eqm in gbt.gambit._lcp_strategy_solve_rational(game, 0, 0))
+        expected_double = [_profile_list(eqm)
+                           for eqm in gbt.gambit._lcp_strategy_solve_double(game, 0, 0)]
+        for threads in [2, 3]:
+            result = sorted(_profile_list(eqm)
+                            for eqm in gbt.gambit._lcp_strategy_solve_rational(game, 0, 0,
+                                                                               threads))
+            assert result == expected
+            result = [_profile_list(eqm)
+                      for eqm in gbt.gambit._lcp_strategy_solve_double(game, 0, 0, threads)]
+            assert len(result) == len(expected_double)
+            for eqm_expected in expected_double:
+                assert any(all(abs(prob - prob_expected) < 1.0e-10
+                               for prob, prob_expected in zip(eqm, eqm_expected))
+                           for eqm in result)
+    result = gbt.gambit._lcp_strategy_solve_rational(_create_battle_of_sexes(), 0, 0, 2)
+    assert sorted(_profile_list(eqm) for eqm in result) == BATTLE_OF_SEXES_EQUILIBRIA
+
+
+def _create_tied_game(shape: tuple, seed: int) -> tuple:
+    """Create a table game with payoffs drawn from a few values, so that many best
+    responses are tied.  Returns the game and the arrays of payoffs."""
+    rng = np.random.default_rng(seed)
+    arrays = [rng.integers(0, 4, size=shape) for _ in shape]
+    return gbt.Game.from_arrays(*arrays), arrays
+
+
+def _pure_equilibria(arrays: list) -> list:
+    """Returns the pure-strategy equilibria of the game with payoffs `arrays`,
+    as tuples of strategy indices, in the order in which enumpure reports them."""
+    nash = np.ones(arrays[0].shape, dtype=bool)
+    for axis, payoffs in enumerate(arrays):
+        nash &= payoffs == payoffs.max(axis=axis, keepdims=True)
+    return sorted((tuple(int(i) for i in index) for index in zip(*np.nonzero(nash))),
+                  key=lambda index: index[::-1])
+
+
+def _pure_profile(profile) -> tuple:
+    return tuple(next(i for i, strategy in enumerate(player.strategies) if profile[strategy] == 1)
+                 for player in profile.game.players)
+
+
+def test_enumpure_strategy_threads():
+    """Test enumeration of pure equilibria on several threads finds every equilibrium,
+    in the same order as on one thread."""
+    game, arrays = _create_tied_game((64, 64, 32), 1)
+    expected = _pure_equilibria(arrays)
+    assert len(expected) > 0
+    for threads in [1, 2, 3]:
+        result = gbt.gambit._enumpure_strategy_solve(game, threads)
+        assert [_pure_profile(eqm) for eqm in result] == expected
+
+
+def test_best_responses():
+    """Test the best-response index of a strategic game records exactly the best
+    responses, whether built on one thread or on several."""
+    game, arrays = _create_tied_game((64, 64, 32), 2)
+    expected = [(payoffs == payoffs.max(axis=axis, keepdims=True)).flatten(order="F").tolist()
+                for axis, payoffs in enumerate(arrays)]
+    for threads in [1, 3]:
+        assert game._best_responses(threads) == expected
+    game, arrays = _create_tied_game((3, 5), 3)
+    expected = [(payoffs == payoffs.max(axis=axis, keepdims=True)).flatten(order="F").tolist()
+                for axis, payoffs in enumerate(arrays)]
+    assert game._best_responses() == expected
+
+
+def test_enumpure_strategy_equal_payoffs():
+    """Test enumeration of pure equilibria treats equal payoffs written differently
+    as tied best responses."""
+    game = gbt.Game.new_table([2, 2])
+    game[[0, 0]][game.players[0]] = "1/2"
+    game[[1, 0]][game.players[0]] = "0.5"
+    game[[0, 1]][game.players[0]] = 1
+    result = gbt.nash.enumpure_solve(game).equilibria
+    assert [_pure_profile(eqm) for eqm in result] == [(0, 0), (1, 0), (0, 1)]
+
+
+@pytest.mark.parametrize("filename", ["poker.efg", "cent3.efg"])
+def test_logit_behavior_converges_to_equilibrium(filename: str):
+    """Test logit on the agent form approaches the unique equilibrium found by LCP."""
+    game = games.read_from_file(filename)
+    expected = gbt.nash.lcp_solve(game, use_strategic=False, rational=True).equilibria
+    assert len(expected) == 1
+    result = gbt.nash.logit_solve(game, use_strategic=False, maxregret=1.0e-10)
+    assert len(result.equilibria) == 1
+    for action in game.actions:
+        assert abs(result.equilibria[0][action] - expected[0][action]) < 1.0e-4
@@ -91,3 +91,39 @@ def test_outcome_payoff_by_player():
     assert game.outcomes[0][player2] == 2
     assert game.outcomes[1][player1] == 3
     assert game.outcomes[1][player2] == 4
+
+
+def test_outcome_payoff_overwrite_values_released():
+    """Test that payoff values which are overwritten, or belong to a deleted outcome,
+    are no longer held by the game."""
+    game = gbt.Game.new_table([2, 2])
+    assert game._num_payoff_values == 1
+    for value in range(1000):
+        game.outcomes[0][game.players[0]] = value
+        game.outcomes[1][game.players[0]] = gbt.Rational(value, 7)
+        game.outcomes[1][game.players[1]] = value
+    assert game._num_payoff_values == 3
+    assert game.outcomes[0][game.players[0]] == 999
+    assert game.outcomes[1][game.players[0]] == gbt.Rational(999, 7)
+    # 999 is still the payoff to the second player at the second outcome
+    game.outcomes[0][game.players[0]] = 0
+    assert game._num_payoff_values == 3
+    game.delete_outcome(game.outcomes[1])
+    assert game._num_payoff_values == 1
+    for outcome in game.outcomes:
+        assert outcome[game.players[0]] == 0
+        assert outcome[game.players[1]] == 0
+
+
+def test_outcome_payoff_shared_value_kept():
+    """Test that a payoff value is held as long as any outcome has it."""
+    game = gbt.Game.new_tree(["Alice", "Bob"])
+    first = game.add_outcome([5, 5])
+    second = game.add_outcome([5, "1/2"])
+    assert game._num_payoff_values == 3
+    game.delete_outcome(first)
+    assert game._num_payoff_values == 3
+    assert second[game.players[0]] == 5
+    second[game.players[0]] = "1/2"
+    assert game._num_payoff_values == 2
+    assert second[game.players[1]] == gbt.Rational(1, 2)
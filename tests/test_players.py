@@ -88,6 +88,25 @@ def test_strategic_game_delete_strategy():
     assert len(game.players[0].strategies) == 1
 
 
+def test_strategic_game_delete_strategy_payoffs():
+    """Test that after deleting a strategy each remaining contingency keeps its outcome
+    and payoffs, and that profiles on the game are evaluated using them.
+    """
+    game = gbt.Game.from_arrays([[1, 2, 3], [4, 5, 6]], [[7, 8, 9], [10, 11, 12]])
+    outcomes = {(i, j): game[[i, j]] for i in range(2) for j in range(3)}
+    game.delete_strategy(game.players[1].strategies[1])
+    assert len(game.players[1].strategies) == 2
+    for i in range(2):
+        for j, old_j in enumerate([0, 2]):
+            assert game[[i, j]] == outcomes[(i, old_j)]
+            assert game[[i, j]][game.players[0]] == 3 * i + old_j + 1
+            assert game[[i, j]][game.players[1]] == 3 * i + old_j + 7
+    profile = game.mixed_strategy_profile(rational=True)
+    assert profile.payoff(game.players[0]) == gbt.Rational(7, 2)
+    assert profile.payoff(game.players[1]) == gbt.Rational(19, 2)
+    assert profile.strategy_value(game.players[0].strategies[1]) == 5
+
+
 def test_strategic_game_delete_last_strategy():
     game = gbt.Game.new_table([1, 2])
     with pytest.raises(gbt.UndefinedOperationError):
@@ -1,3 +1,5 @@
+import itertools
+
 import pygambit as gbt
 import pytest
 
@@ -82,9 +84,106 @@ def test_undominated():
     )
 
 
+def _dominated_strategies(game: gbt.Game, strict: bool) -> set:
+    """Find by brute force the strategies dominated by another of the same player's
+    strategies, comparing payoffs exactly in every contingency.
+    """
+    dominated = set()
+    for pl, player in enumerate(game.players):
+        others = [range(len(p.strategies)) for p in game.players if p != player]
+        contingencies = list(itertools.product(*others))
+        for st1, st2 in itertools.permutations(range(len(player.strategies)), 2):
+            diffs = []
+            for cont in contingencies:
+                profile = list(cont)
+                payoff2 = game[profile[:pl] + [st2] + profile[pl:]][player]
+                payoff1 = game[profile[:pl] + [st1] + profile[pl:]][player]
+                diffs.append(gbt.Rational(payoff1) - gbt.Rational(payoff2))
+            if all(d > 0 for d in diffs) if strict else (
+                    all(d >= 0 for d in diffs) and any(d > 0 for d in diffs)):
+                dominated.add(player.strategies[st2])
+    return dominated
+
+
+def _create_near_ties_game() -> gbt.Game:
+    """Create a 3x3x2 game in which strategies dominate others only by less than the
+    precision of a double, so that dominance must be decided in exact arithmetic.
+    """
+    eps = gbt.Rational(1, 10**20)
+    game = gbt.Game.new_table([3, 3, 2])
+    for i, j, k in itertools.product(range(3), range(3), range(2)):
+        # The first player's second strategy is strictly dominated, and the third weakly
+        base = j + 2 * k + gbt.Rational(1, 3)
+        game[[i, j, k]][game.players[0]] = [base, base - eps, base - eps * ((j + k) % 2)][i]
+        # The second player's third strategy strictly dominates the first
+        base = 2 * i - k + gbt.Rational(2, 7)
+        game[[i, j, k]][game.players[1]] = [base, base + (eps if i == 0 else -eps),
+                                            base + eps][j]
+        # The third player's first strategy is weakly dominated
+        base = gbt.Rational(i * j + 1, 3)
+        game[[i, j, k]][game.players[2]] = base + eps * k * ((i + j) % 3 == 0)
+    return game
+
+
+@pytest.mark.parametrize("strict", [False, True])
+def test_undominated_near_ties(strict: bool):
+    """Test dominance is decided exactly when payoffs are closer than floating-point
+    precision can tell apart."""
+    game = gbt.Game.from_arrays(
+        [[gbt.Rational(1, 3), 1], ["0.3333333333333333", "0.99999999999999999"],
+         [gbt.Rational(1, 3), "0.99999999999999999"], [0, 2]],
+        [[0, 0], [0, 0], [0, 0], [0, 0]]
+    )
+    profile = gbt.supports.undominated_strategies_solve(game.support_profile(), strict=strict)
+    strategies = game.players[0].strategies
+    # The first strategy strictly dominates the second, and weakly dominates the third
+    if strict:
+        expected = [strategies[0], strategies[2], strategies[3]]
+    else:
+        expected = [strategies[0], strategies[3]]
+    assert [s for s in strategies if s in profile] == expected
+    assert all(s in profile for s in game.players[1].strategies)
+
+
+@pytest.mark.parametrize("strict", [False, True])
+def test_undominated_matches_brute_force(strict: bool):
+    game = _create_near_ties_game()
+    profile = gbt.supports.undominated_strategies_solve(game.support_profile(), strict=strict)
+    dominated = _dominated_strategies(game, strict)
+    for strategy in game.strategies:
+        assert (strategy in profile) == (strategy not in dominated)
+
+
+def test_undominated_iterated_to_equilibrium():
+    """Test iterated elimination of strictly dominated strategies in a game which is
+    solvable that way leaves exactly its unique equilibrium."""
+    game = gbt.Game.from_arrays([[3, 0, 2], [5, 1, 3], [4, 0, 1]],
+                                [[3, 5, 1], [0, 1, 0], [2, 3, 1]])
+    profile = game.support_profile()
+    while True:
+        reduced = gbt.supports.undominated_strategies_solve(profile, strict=True)
+        if reduced == profile:
+            break
+        profile = reduced
+    assert list(profile) == [game.players[0].strategies[1], game.players[1].strategies[1]]
+    equilibria = gbt.nash.enumpure_solve(game).equilibria
+    assert len(equilibria) == 1
+    assert equilibria[0][game.players[0].strategies[1]] == 1
+    assert equilibria[0][game.players[1].strategies[1]] == 1
+
+
 def test_remove_error():
     game = games.read_from_file("mixed_strategy.nfg")
     support_profile = game.support_profile()
     profile = support_profile.remove(support_profile[3])
     with pytest.raises(gbt.UndefinedOperationError):
         profile.remove(profile[3])
+
+
+def test_undominated_mixed():
+    game = gbt.Game.from_arrays([[3, 0], [0, 3], [1, 1]], [[1, 0], [0, 1], [0, 0]])
+    support_profile = game.support_profile()
+    assert gbt.supports.undominated_strategies_solve(support_profile) == support_profile
+    mixed_profile = gbt.supports.undominated_strategies_solve(support_profile, mixed=True)
+    assert len(mixed_profile) == 4
+    assert game.players[0].strategies[2] not in mixed_profile